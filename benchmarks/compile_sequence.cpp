@@ -0,0 +1,39 @@
+#include <cstddef>
+#include "../src/aux/sequence.hpp"
+
+/*
+ * Compile-time benchmark for tuple_utils::make_sequence, see compile_time.sh.
+ * SEQUENCE_SIZE sets the length of generated sequences, SEQUENCE_COUNT sequences of different lengths
+ * are generated so the compiler can not reuse previous instantiations.
+ */
+
+#ifndef SEQUENCE_SIZE
+#define SEQUENCE_SIZE 64
+#endif
+
+#ifndef SEQUENCE_COUNT
+#define SEQUENCE_COUNT 32
+#endif
+
+template <int... I>
+std::size_t length(tuple_utils::sequence<I...>)
+{
+    return sizeof...(I);
+}
+
+template <int... K>
+std::size_t total(tuple_utils::sequence<K...>)
+{
+    std::size_t lengths[] = {length(typename tuple_utils::make_sequence<SEQUENCE_SIZE + K>::type())...};
+    std::size_t result = 0;
+    for (auto l : lengths)
+    {
+        result += l;
+    }
+    return result;
+}
+
+int main()
+{
+    return total(tuple_utils::make_sequence<SEQUENCE_COUNT>::type()) == 0;
+}
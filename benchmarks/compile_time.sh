@@ -0,0 +1,33 @@
+#!/bin/sh
+#
+# Measure compilation time of the compile-time benchmarks for a few input sizes.
+# Usage: compile_time.sh [benchmark] [sizes...]
+#   benchmark - name of the benchmarks/compile_<benchmark>.cpp file, "sequence" by default
+#   sizes     - values passed to the benchmark, "64 256 1024" by default
+# Compiler is taken from the CXX environment variable, flags from CXXFLAGS.
+# Every size is compiled twice: with compiler built-ins enabled and with the portable
+# implementation forced by TUPLE_UTILS_NO_SEQUENCE_INTRINSICS.
+
+CXX=${CXX:-c++}
+CXXFLAGS=${CXXFLAGS:-"-std=c++11"}
+DIR=$(cd "$(dirname "$0")" && pwd)
+BENCH=${1:-sequence}
+[ $# -gt 0 ] && shift
+SIZES=${*:-"64 256 1024"}
+NAME=$(echo "$BENCH" | tr '[:lower:]' '[:upper:]')
+
+compile_ms()
+{
+    start=$(date +%s%N)
+    $CXX $CXXFLAGS -ftemplate-depth=2048 -fsyntax-only "$@" "$DIR/compile_$BENCH.cpp" || return 1
+    end=$(date +%s%N)
+    echo $(( (end - start) / 1000000 ))
+}
+
+printf "%-8s %-12s %-12s\n" "N" "builtin[ms]" "portable[ms]"
+for N in $SIZES
+do
+    builtin=$(compile_ms -D${NAME}_SIZE=$N) || builtin="error"
+    portable=$(compile_ms -D${NAME}_SIZE=$N -DTUPLE_UTILS_NO_SEQUENCE_INTRINSICS) || portable="error"
+    printf "%-8s %-12s %-12s\n" "$N" "$builtin" "$portable"
+done
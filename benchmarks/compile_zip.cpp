@@ -0,0 +1,32 @@
+#include <cstddef>
+#include <tuple>
+#include "../src/zip_tuples.hpp"
+
+/*
+ * Compile-time benchmark for tuple_utils::zip, see compile_time.sh.
+ * ZIP_SIZE sets the number of columns of zipped tuples. Every column has distinct type, so every
+ * row of the result has distinct type as well and nothing could be reused by the compiler.
+ */
+
+#ifndef ZIP_SIZE
+#define ZIP_SIZE 64
+#endif
+
+template <std::size_t I>
+struct column
+{
+    int value;
+};
+
+template <std::size_t... I>
+std::tuple<column<I>...> make_columns(tuple_utils::index_sequence<I...>)
+{
+    return std::tuple<column<I>...>(column<I>{static_cast<int>(I)}...);
+}
+
+int main()
+{
+    auto first = make_columns(tuple_utils::make_index_sequence<ZIP_SIZE>());
+    auto result = tuple_utils::zip(first, make_columns(tuple_utils::make_index_sequence<ZIP_SIZE + 1>()), first);
+    return std::tuple_size<decltype(result)>::value == ZIP_SIZE ? 0 : 1;
+}
@@ -0,0 +1,108 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <tuple>
+#include <vector>
+#include "../src/fold_rows.hpp"
+#include "../src/fold_tuples.hpp"
+#include "../src/soa_vector.hpp"
+
+/*
+ * Runtime benchmark of tuple_utils::fold_rows against a naive loop which folds one row at a time into
+ * a tuple of partial results with tuple_utils::fold. All compute the same right fold of every column.
+ * fold_rows reads std::vector of std::tuples once, row by row, and folds soa_vector with one loop per
+ * contiguous column. The last measurement converts the rows to soa_vector in every pass, which costs much
+ * more than the fold itself, so columns pay off when the data is kept in soa_vector.
+ * Build with optimizations, e.g. c++ -std=c++11 -O3 -march=native runtime_fold_rows.cpp, GCC reports
+ * vectorized loops with -fopt-info-vec. Columns are integers, so sums could be reordered and vectorized
+ * without -ffast-math.
+ * FOLD_ROWS_SIZE sets the number of rows, FOLD_ROWS_REPEAT the number of passes.
+ */
+
+#ifndef FOLD_ROWS_SIZE
+#define FOLD_ROWS_SIZE 1000000
+#endif
+
+#ifndef FOLD_ROWS_REPEAT
+#define FOLD_ROWS_REPEAT 100
+#endif
+
+using row = std::tuple<int, long, int, long>;
+using result = std::tuple<int, long, int, long>;
+
+struct Add
+{
+    template <class T>
+    T operator()(T x, T y) const
+    {
+        return x + y;
+    }
+};
+
+__attribute__((noinline))
+result naive(const std::vector<row>& rows)
+{
+    result partial = rows.back();
+    for (std::size_t i = rows.size() - 1; i-- > 0;)
+    {
+        partial = tuple_utils::fold(Add(), rows[i], partial);
+    }
+    return partial;
+}
+
+__attribute__((noinline))
+result columns(const std::vector<row>& rows)
+{
+    return tuple_utils::fold_rows(Add(), rows);
+}
+
+__attribute__((noinline))
+result soa(const tuple_utils::soa_vector<int, long, int, long>& rows)
+{
+    return tuple_utils::fold_rows(Add(), rows);
+}
+
+__attribute__((noinline))
+result transposed(const std::vector<row>& rows)
+{
+    return tuple_utils::fold_rows(Add(), tuple_utils::soa_vector<int, long, int, long>(rows));
+}
+
+template <
+        typename Loop,
+        typename Rows
+        >
+double measure(Loop loop, const Rows& rows, result& sum)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < FOLD_ROWS_REPEAT; ++r)
+    {
+        sum = loop(rows);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main()
+{
+    std::vector<row> rows;
+    rows.reserve(FOLD_ROWS_SIZE);
+    for (int i = 0; i < FOLD_ROWS_SIZE; ++i)
+    {
+        rows.push_back(std::make_tuple(i % 7, static_cast<long>(i), -(i % 5), 3L * i));
+    }
+    const tuple_utils::soa_vector<int, long, int, long> columnsOfRows(rows);
+
+    result naiveSum, columnsSum, soaSum, transposedSum;
+    const double naiveMs = measure(naive, rows, naiveSum);
+    const double columnsMs = measure(columns, rows, columnsSum);
+    const double soaMs = measure(soa, columnsOfRows, soaSum);
+    const double transposedMs = measure(transposed, rows, transposedSum);
+
+    std::cout << FOLD_ROWS_REPEAT << " passes over " << FOLD_ROWS_SIZE << " rows" << std::endl
+              << "naive row loop              " << naiveMs << " ms" << std::endl
+              << "fold_rows(vector)           " << columnsMs << " ms" << std::endl
+              << "fold_rows(soa_vector)       " << soaMs << " ms" << std::endl
+              << "fold_rows(soa_vector(rows)) " << transposedMs << " ms" << std::endl;
+    return naiveSum == columnsSum && naiveSum == soaSum && naiveSum == transposedSum ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <tuple>
+#include "../src/fold_tuples.hpp"
+
+/*
+ * Runtime benchmark of tuple_utils::fold_tree against tuple_utils::fold and tuple_utils::fold_left for
+ * 16 folded tuples. Every step scales all 16 values by the result of the previous step, so the time is
+ * limited by the latency of the chain of additions: 15 dependent additions for fold and fold_left,
+ * 4 for fold_tree. Build with optimizations, e.g. c++ -std=c++11 -O2 runtime_fold_tree.cpp (without
+ * -ffast-math, which would allow the compiler to reorder the additions by itself).
+ * FOLD_TREE_REPEAT sets the number of steps.
+ */
+
+#ifndef FOLD_TREE_REPEAT
+#define FOLD_TREE_REPEAT 20000000
+#endif
+
+struct Add
+{
+    double operator()(double x, double y) const
+    {
+        return x + y;
+    }
+};
+
+template <
+        typename Order,
+        std::size_t... I
+        >
+double fold16(Order order, const double* values, double scale, tuple_utils::index_sequence<I...>)
+{
+    return std::get<0>(order(std::make_tuple(values[I] * scale)...));
+}
+
+struct Right
+{
+    template <typename... Tuples>
+    auto operator()(Tuples&&... tuples) const -> decltype(tuple_utils::fold(Add(), std::forward<Tuples>(tuples)...))
+    {
+        return tuple_utils::fold(Add(), std::forward<Tuples>(tuples)...);
+    }
+};
+
+struct Left
+{
+    template <typename... Tuples>
+    auto operator()(Tuples&&... tuples) const -> decltype(tuple_utils::fold_left(Add(), std::forward<Tuples>(tuples)...))
+    {
+        return tuple_utils::fold_left(Add(), std::forward<Tuples>(tuples)...);
+    }
+};
+
+struct Tree
+{
+    template <typename... Tuples>
+    auto operator()(Tuples&&... tuples) const -> decltype(tuple_utils::fold_tree(Add(), std::forward<Tuples>(tuples)...))
+    {
+        return tuple_utils::fold_tree(Add(), std::forward<Tuples>(tuples)...);
+    }
+};
+
+template <
+        typename Order
+        >
+__attribute__((noinline))
+double run(Order order, const double* values, double& result)
+{
+    const auto start = std::chrono::steady_clock::now();
+    double scale = 1.0;
+    for (long r = 0; r < FOLD_TREE_REPEAT; ++r)
+    {
+        scale = 1.0 / 16 + fold16(order, values, scale, tuple_utils::make_index_sequence<16>()) * (1.0 / 64);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    result = scale;
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main()
+{
+    double values[16];
+    for (std::size_t i = 0; i < 16; ++i)
+    {
+        values[i] = 1.0 + static_cast<double>(i) / 16;
+    }
+
+    double right = 0, left = 0, tree = 0;
+    const double rightMs = run(Right(), values, right);
+    const double leftMs = run(Left(), values, left);
+    const double treeMs = run(Tree(), values, tree);
+
+    std::cout << FOLD_TREE_REPEAT << " steps of 16 additions" << std::endl
+              << "fold      " << rightMs << " ms" << std::endl
+              << "fold_left " << leftMs << " ms" << std::endl
+              << "fold_tree " << treeMs << " ms" << std::endl;
+    //additions of doubles are not associative, so results could differ only slightly
+    return (right - tree) * (right - tree) < 1e-12 && (left - tree) * (left - tree) < 1e-12 ? 0 : 1;
+}
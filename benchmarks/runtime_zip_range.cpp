@@ -0,0 +1,74 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <tuple>
+#include <vector>
+#include "../src/zip_range.hpp"
+
+/*
+ * Runtime benchmark of tuple_utils::zip_range against a hand-written indexed loop.
+ * Build with optimizations, e.g. c++ -std=c++11 -O3 -march=native runtime_zip_range.cpp, both loops
+ * should be vectorized (GCC reports it with -fopt-info-vec) and take about the same time.
+ * ZIP_RANGE_SIZE sets the number of elements of each vector, ZIP_RANGE_REPEAT the number of passes.
+ */
+
+#ifndef ZIP_RANGE_SIZE
+#define ZIP_RANGE_SIZE 4096
+#endif
+
+#ifndef ZIP_RANGE_REPEAT
+#define ZIP_RANGE_REPEAT 100000
+#endif
+
+__attribute__((noinline))
+void indexed(const std::vector<float>& x, const std::vector<float>& y, std::vector<float>& out, float a)
+{
+    const std::size_t size = out.size();
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        out[i] = a * x[i] + y[i];
+    }
+}
+
+__attribute__((noinline))
+void zipped(const std::vector<float>& x, const std::vector<float>& y, std::vector<float>& out, float a)
+{
+    for (auto row : tuple_utils::zip_range(x, y, out))
+    {
+        std::get<2>(row) = a * std::get<0>(row) + std::get<1>(row);
+    }
+}
+
+template <
+        typename Loop
+        >
+double measure(Loop loop, const std::vector<float>& x, const std::vector<float>& y, std::vector<float>& out)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < ZIP_RANGE_REPEAT; ++r)
+    {
+        loop(x, y, out, 1.0f + static_cast<float>(r % 3));
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main()
+{
+    std::vector<float> x(ZIP_RANGE_SIZE), y(ZIP_RANGE_SIZE), out(ZIP_RANGE_SIZE);
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        x[i] = static_cast<float>(i);
+        y[i] = static_cast<float>(i % 7);
+    }
+
+    const double indexedMs = measure(indexed, x, y, out);
+    const float indexedCheck = out[ZIP_RANGE_SIZE / 2];
+    const double zippedMs = measure(zipped, x, y, out);
+    const float zippedCheck = out[ZIP_RANGE_SIZE / 2];
+
+    std::cout << "size " << ZIP_RANGE_SIZE << ", " << ZIP_RANGE_REPEAT << " passes" << std::endl
+              << "indexed loop   " << indexedMs << " ms" << std::endl
+              << "zip_range loop " << zippedMs << " ms" << std::endl;
+    return indexedCheck == zippedCheck ? 0 : 1;
+}
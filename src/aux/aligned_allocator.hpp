@@ -0,0 +1,103 @@
+#ifndef TUTILS_ALIGNED_ALLOCATOR_HPP
+#define TUTILS_ALIGNED_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+
+/**
+ * @file
+ * @author
+ * @version
+*/
+
+//! Utilities for tuples manipulation
+namespace tuple_utils
+{
+
+/**
+ * @brief Size of cache line assumed by containers of tuple_utils, alignment of their arrays
+ */
+constexpr std::size_t cache_line_size = 64;
+
+/**
+ * @brief Allocator returning memory aligned to Alignment bytes, e.g. to the beginning of a cache line
+ * Allocates Alignment - 1 + sizeof(void*) additional bytes with operator new, address returned by
+ * operator new is kept just before the aligned block so it could be released by deallocate, so the block
+ * has to be aligned for void* too.
+ * @tparam T - type of allocated elements
+ * @tparam Alignment - power of two not smaller than alignment of T and of void*
+ */
+template <
+        typename T,
+        std::size_t Alignment = cache_line_size
+        >
+struct aligned_allocator
+{
+    static_assert(Alignment != 0 && (Alignment & (Alignment - 1)) == 0, "Alignment has to be a power of two");
+    static_assert(Alignment >= alignof(T), "Alignment has to be at least the alignment of T");
+    static_assert(Alignment >= alignof(void*), "Alignment has to be at least the alignment of void*");
+
+    using value_type = T;
+
+    template <
+            typename U
+            >
+    struct rebind
+    {
+        using other = aligned_allocator<U, Alignment>;
+    };
+
+    aligned_allocator() noexcept
+    { }
+
+    template <
+            typename U
+            >
+    aligned_allocator(const aligned_allocator<U, Alignment>&) noexcept
+    { }
+
+    T* allocate(std::size_t n)
+    {
+        const std::size_t extra = Alignment - 1 + sizeof(void*);
+        if (n > (std::numeric_limits<std::size_t>::max() - extra) / sizeof(T))
+        {
+            throw std::bad_alloc();
+        }
+        void* raw = ::operator new(n * sizeof(T) + extra);
+        const std::uintptr_t aligned =
+                (reinterpret_cast<std::uintptr_t>(raw) + extra) & ~static_cast<std::uintptr_t>(Alignment - 1);
+        reinterpret_cast<void**>(aligned)[-1] = raw;
+        return reinterpret_cast<T*>(aligned);
+    }
+
+    void deallocate(T* p, std::size_t) noexcept
+    {
+        ::operator delete(reinterpret_cast<void**>(p)[-1]);
+    }
+};
+
+template <
+        typename T,
+        typename U,
+        std::size_t Alignment
+        >
+bool operator==(const aligned_allocator<T, Alignment>&, const aligned_allocator<U, Alignment>&) noexcept
+{
+    return true;
+}
+
+template <
+        typename T,
+        typename U,
+        std::size_t Alignment
+        >
+bool operator!=(const aligned_allocator<T, Alignment>&, const aligned_allocator<U, Alignment>&) noexcept
+{
+    return false;
+}
+
+} // namespace tuple_utils
+
+#endif // TUTILS_ALIGNED_ALLOCATOR_HPP
@@ -0,0 +1,144 @@
+#ifndef TUTILS_GET_HPP
+#define TUTILS_GET_HPP
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @file
+ * @author
+ * @version
+*/
+
+/**
+ * @brief constexpr for functions forwarding their arguments, std::forward and std::get are constexpr since C++14
+ * In C++11 such functions are ordinary inline functions.
+ */
+#if __cplusplus >= 201402L
+#define TUTILS_CONSTEXPR14 constexpr
+#else
+#define TUTILS_CONSTEXPR14
+#endif
+
+//! Utilities for tuples manipulation
+namespace tuple_utils
+{
+
+///@internal
+namespace details
+{
+
+/**
+ * @brief Namespace used only to make std::get visible for unqualified calls in tuple_get
+ */
+namespace get_lookup
+{
+
+using std::get;
+
+/**
+ * @brief Get I-th element of std::tuple, std::pair or any other tuple-like type (e.g. merged_view).
+ * Unqualified call finds std::get for standard types and, through argument dependent lookup, get
+ * functions declared next to other tuple-like types. Value category of the tuple is preserved, so
+ * elements of rvalue tuples are returned as rvalue references.
+ */
+template <
+        std::size_t I,
+        typename Tuple
+        >
+TUTILS_CONSTEXPR14 auto tuple_get(Tuple&& tuple)
+-> decltype(get<I>(std::forward<Tuple>(tuple)))
+{
+    return get<I>(std::forward<Tuple>(tuple));
+}
+
+} //namespace get_lookup
+
+using get_lookup::tuple_get;
+
+/**
+ * @brief Type returned by tuple_get<I> for Tuple, reference to the element with the value category of Tuple
+ * Tuple given as a non-reference type is treated as an rvalue, as for std::declval.
+ */
+template <
+        std::size_t I,
+        typename Tuple
+        >
+struct tuple_get_type
+{
+    using type = decltype(tuple_get<I>(std::declval<Tuple>()));
+};
+
+/**
+ * @brief Get element of a tuple which is used more than once, always returned as lvalue reference
+ * Used when the same element is read many times, so it could not be moved from even for rvalue tuples.
+ */
+template <bool Forward>
+struct element_forwarder
+{
+    template <
+            std::size_t I,
+            typename Tuple
+            >
+    static auto get(Tuple&& tuple)
+    -> decltype(tuple_get<I>(tuple))
+    {
+        return tuple_get<I>(tuple);
+    }
+};
+
+/**
+ * @brief Get element of a tuple which is used only once, value category of the tuple is preserved
+ * so elements of rvalue tuples could be moved.
+ */
+template <>
+struct element_forwarder<true>
+{
+    template <
+            std::size_t I,
+            typename Tuple
+            >
+    static auto get(Tuple&& tuple)
+    -> decltype(tuple_get<I>(std::forward<Tuple>(tuple)))
+    {
+        return tuple_get<I>(std::forward<Tuple>(tuple));
+    }
+};
+
+/**
+ * @brief Pass element of a container with the value category of the container
+ * Source is the type a container was forwarded as, element x is returned as rvalue reference when
+ * Source is not an lvalue reference, so elements of rvalue containers could be moved one by one.
+ */
+template <
+        typename Source,
+        typename T
+        >
+auto forward_like(T& x)
+-> typename std::conditional<std::is_lvalue_reference<Source>::value, T&, T&&>::type
+{
+    return static_cast<typename std::conditional<std::is_lvalue_reference<Source>::value, T&, T&&>::type>(x);
+}
+
+/**
+ * @brief Used only to expand expressions with side effects in order, as a statement
+ * Elements of braced initializer list are evaluated from left to right, e.g.
+ * expand{(f(std::get<I>(tuple)), 0)...} calls f for elements 0, 1,... in that order.
+ */
+struct expand
+{
+    template <
+            typename... T
+            >
+    explicit expand(T&&...)
+    { }
+};
+
+} //namespace details
+///@endinternal
+
+} // namespace tuple_utils
+
+#endif // TUTILS_GET_HPP
@@ -0,0 +1,140 @@
+#ifndef TUTILS_INDEXED_ITERATOR_HPP
+#define TUTILS_INDEXED_ITERATOR_HPP
+
+#include <cstddef>
+
+/**
+ * @file
+ * @author
+ * @version
+*/
+
+//! Utilities for tuples manipulation
+namespace tuple_utils
+{
+
+///@internal
+namespace details
+{
+
+/**
+ * @brief Base of iterators which keep one index, e.g. zip_iterator and product_iterator
+ * Provides all random access moving and comparing of iterators, which touch only the index, Derived
+ * provides dereference.
+ * Iterators are compared only by their indices, so both have to iterate over the same range.
+ * @tparam Derived - iterator type derived from indexed_iterator<Derived>
+ */
+template <
+        typename Derived
+        >
+class indexed_iterator
+{
+public:
+    Derived& operator++()
+    {
+        ++index;
+        return derived();
+    }
+
+    Derived operator++(int)
+    {
+        Derived copy(derived());
+        ++index;
+        return copy;
+    }
+
+    Derived& operator--()
+    {
+        --index;
+        return derived();
+    }
+
+    Derived operator--(int)
+    {
+        Derived copy(derived());
+        --index;
+        return copy;
+    }
+
+    Derived& operator+=(std::ptrdiff_t n)
+    {
+        index += n;
+        return derived();
+    }
+
+    Derived& operator-=(std::ptrdiff_t n)
+    {
+        index -= n;
+        return derived();
+    }
+
+    friend Derived operator+(Derived it, std::ptrdiff_t n)
+    {
+        return it += n;
+    }
+
+    friend Derived operator+(std::ptrdiff_t n, Derived it)
+    {
+        return it += n;
+    }
+
+    friend Derived operator-(Derived it, std::ptrdiff_t n)
+    {
+        return it -= n;
+    }
+
+    friend std::ptrdiff_t operator-(const indexed_iterator& x, const indexed_iterator& y)
+    {
+        return x.index - y.index;
+    }
+
+    friend bool operator==(const indexed_iterator& x, const indexed_iterator& y)
+    {
+        return x.index == y.index;
+    }
+
+    friend bool operator!=(const indexed_iterator& x, const indexed_iterator& y)
+    {
+        return x.index != y.index;
+    }
+
+    friend bool operator<(const indexed_iterator& x, const indexed_iterator& y)
+    {
+        return x.index < y.index;
+    }
+
+    friend bool operator>(const indexed_iterator& x, const indexed_iterator& y)
+    {
+        return x.index > y.index;
+    }
+
+    friend bool operator<=(const indexed_iterator& x, const indexed_iterator& y)
+    {
+        return x.index <= y.index;
+    }
+
+    friend bool operator>=(const indexed_iterator& x, const indexed_iterator& y)
+    {
+        return x.index >= y.index;
+    }
+
+protected:
+    explicit indexed_iterator(std::ptrdiff_t index)
+        : index(index)
+    { }
+
+    std::ptrdiff_t index;
+
+private:
+    Derived& derived()
+    {
+        return static_cast<Derived&>(*this);
+    }
+};
+
+} //namespace details
+///@endinternal
+
+} // namespace tuple_utils
+
+#endif // TUTILS_INDEXED_ITERATOR_HPP
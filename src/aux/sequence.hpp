@@ -2,6 +2,8 @@
 #define SEQUENCE_HPP
 
 #include <cstdio>
+#include <cstddef>
+#include <utility>
 #include <type_traits>
 #include <iostream>
 #include "static.hpp"
@@ -12,6 +14,18 @@
  * @version
 */
 
+/*
+ * Compiler built-ins generating integer sequences in one instantiation are used when available.
+ * Define TUPLE_UTILS_NO_SEQUENCE_INTRINSICS to always use the portable implementation.
+ */
+#if !defined(TUPLE_UTILS_NO_SEQUENCE_INTRINSICS) && defined(__has_builtin)
+#  if __has_builtin(__make_integer_seq)
+#    define TUPLE_UTILS_HAS_MAKE_INTEGER_SEQ
+#  elif __has_builtin(__integer_pack)
+#    define TUPLE_UTILS_HAS_INTEGER_PACK
+#  endif
+#endif
+
 //! Utilities for tuples manipulation
 namespace tuple_utils
 {
@@ -61,79 +75,195 @@ template <>
 struct sequence<>
 { };
 
+#if __cplusplus >= 201402L
+
+using std::integer_sequence;
+using std::index_sequence;
+
+#else
+
+/**
+ * @brief Compile-time sequence of values of type T, equivalent of C++14 std::integer_sequence.
+ * In C++14 and later tuple_utils::integer_sequence is std::integer_sequence, so standard index packs
+ * could be passed directly to tuple_utils functions.
+ */
+template <
+        typename T,
+        T... I
+        >
+struct integer_sequence
+{
+    using value_type = T;
+
+    static constexpr std::size_t size() noexcept
+    {
+        return sizeof...(I);
+    }
+};
+
+/**
+ * @brief Sequence of std::size_t values, equivalent of C++14 std::index_sequence.
+ * It is used by tuple_utils internally for every pack of indices into std::tuple.
+ */
+template <
+        std::size_t... I
+        >
+using index_sequence = integer_sequence<std::size_t, I...>;
+
+#endif
+
 ///@internal
 namespace details
 {
 
+#if defined(TUPLE_UTILS_HAS_MAKE_INTEGER_SEQ)
+
+/**
+ * @brief Helper struct used by make_sequence, generates index_sequence 0, 1, 2,..., N-1.
+ * Uses Clang built-in __make_integer_seq, so the whole sequence is generated by one instantiation.
+ */
+template <
+        std::size_t N
+        >
+struct sequence_det
+{
+    using type = __make_integer_seq<integer_sequence, std::size_t, N>;
+};
+
+#elif defined(TUPLE_UTILS_HAS_INTEGER_PACK)
+
+/**
+ * @brief Helper struct used by make_sequence, generates index_sequence 0, 1, 2,..., N-1.
+ * Uses GCC built-in __integer_pack, so the whole sequence is generated by one instantiation.
+ */
+template <
+        std::size_t N
+        >
+struct sequence_det
+{
+    using type = index_sequence<__integer_pack(N)...>;
+};
+
+#else
+
 //forward declaration
 template <
-        int Min,
-        int Step,
-        int Max,
-        int Curr,
         typename,
-        int... Args
+        typename
         >
-struct sequence_det;
+struct sequence_join;
+
+/**
+ * @brief Join two sequences 0, 1,..., N-1 and 0, 1,..., M-1 into one sequence 0, 1,..., N+M-1.
+ * Every value from the second sequence is shifted by the size of the first one, so both halves are
+ * glued together with a single pack expansion.
+ */
+template <
+        std::size_t... First,
+        std::size_t... Second
+        >
+struct sequence_join<index_sequence<First...>, index_sequence<Second...>>
+{
+    using type = index_sequence<First..., (sizeof...(First) + Second)...>;
+};
+
+/**
+ * @brief Helper struct used by make_sequence, generates index_sequence 0, 1, 2,..., N-1.
+ * Sequence is generated by divide and conquer: both halves are generated separately and then joined
+ * by sequence_join. Both halves differ at most by one element, so only about 2*log2(N) distinct
+ * instantiations are needed and recursion depth is equal to log2(N) instead of N.
+ */
+template <
+        std::size_t N
+        >
+struct sequence_det : sequence_join<typename sequence_det<N / 2>::type, typename sequence_det<N - N / 2>::type>
+{ };
+
+/**
+ * @brief Last recursive step of sequence_det, generates one element sequence.
+ */
+template <>
+struct sequence_det<1>
+{
+    using type = index_sequence<0>;
+};
 
 /**
- * @brief Helper struct used by make_sequence, generates sequence by adding elements to a parameters pack.
- * In each step it adds next element after the prevoius ones, starting with Min value and in each
- * step adding Step until it exceeds Max value. std::enable_if is used to check if next step is not greater
- * than Max (or if Step is less than zero if next step is not less than Min), if so, special case of
- * sequence_det is used and sequence is completed.
+ * @brief Special case of sequence_det, generates empty sequence.
  */
+template <>
+struct sequence_det<0>
+{
+    using type = index_sequence<>;
+};
+
+#endif
+
+//forward declaration
 template <
         int Min,
         int Step,
-        int Max,
-        int Curr,
-        int... Tail
+        typename
         >
-struct sequence_det<
-        Min,
-        Step,
-        Max,
-        Curr,
-        typename std::enable_if<((Step >= 0) && (Curr + Step < Max)) || ((Step <= 0) && (Curr + Step > Max))>::type,
-        Tail...
-        > : sequence_det<Min, Step, Max, Curr + Step, void, Tail..., Curr + Step>
-{ };
+struct sequence_shift;
 
 /**
- * @brief Last recursive step of sequence_det, hit when iterating from Min to Max with Step interval.
- * It is used when next step is greater than Max (or if Step is less than zero if next step is not less than Min), it
- * is time to collect values and put them into sequence parameters.
+ * @brief Transform sequence 0, 1,..., N-1 into Min, Min + Step,..., Min + (N-1)*Step.
  */
 template <
         int Min,
         int Step,
-        int Max,
-        int Curr,
-        int... Tail
+        std::size_t... Seq
         >
-struct sequence_det<
-        Min,
-        Step,
-        Max,
-        Curr,
-        typename std::enable_if<((Step >= 0) && (Curr + Step >= Max)) || ((Step <= 0) && (Curr + Step <= Max))>::type,
-        Tail...
+struct sequence_shift<Min, Step, index_sequence<Seq...>>
+{
+    using type = sequence<(Min + static_cast<int>(Seq) * Step)...>;
+};
+
+/**
+ * @brief Number of elements in sequence from Min to Max with Step interval.
+ * Max is never included in the sequence, so it is equal to the ceiling of (Max - Min) / Step.
+ */
+template <
+        int Min,
+        int Step,
+        int Max
         >
+struct sequence_length
 {
     static_assert((Step > 0 && Min <= Max) || (Step < 0 && Min >= Max), "Invalid sequence");
-    using seq = sequence<Min, Tail...>;
+    static constexpr std::size_t value = (Max - Min + Step - (Step > 0 ? 1 : -1)) / Step;
 };
 
 } //namespace details
 ///@endinternal
 
+/**
+ * @brief Create index_sequence 0, 1, 2,..., N-1, equivalent of C++14 std::make_index_sequence.
+ * Used to expand indices of std::tuple with N elements. In C++14 and later the resulting type is the
+ * same as the one created by std::make_index_sequence<N>.
+ */
+template <
+        std::size_t N
+        >
+using make_index_sequence = typename details::sequence_det<N>::type;
+
+/**
+ * @brief Create index_sequence with indices of all types from the parameter pack T...
+ */
+template <
+        typename... T
+        >
+using index_sequence_for = make_index_sequence<sizeof...(T)>;
+
 /**
  * @brief Create seqence from Min to Max with Step interval (Min, Min + Step, Min + 2*Step,... Max).
  * Default values allow to use it with only Max template parameter value so it
  * generates seqence 0, 1, 2,... Max. If Max is not a multiple of Min + X * Step values, then last value
  * in series less than Max is added to the sequence. It can be used to create reverse sequence, just use
- * Min > Max and Step < 0.
+ * Min > Max and Step < 0. Depth of template instantiation is logarithmic with respect to the length
+ * of the sequence, so it is safe to use it for tuples with hundreds of elements. Use make_index_sequence
+ * when only indices into std::tuple are needed.
  */
 template <
         int Max,
@@ -142,7 +272,11 @@ template <
         >
 struct make_sequence
 {
-    using type = typename details::sequence_det<Min, Step, Max, Min, void>::seq;
+    using type = typename details::sequence_shift<
+        Min,
+        Step,
+        make_index_sequence<details::sequence_length<Min, Step, Max>::value>
+    >::type;
 };
 
 /**
@@ -157,6 +291,50 @@ struct make_sequence<Max, Max, Step>
     using type = sequence<>;
 };
 
+//forward declaration
+template <typename>
+struct to_index_sequence;
+
+/**
+ * @brief Convert sequence of non-negative int's into index_sequence with the same values.
+ */
+template <
+        int... I
+        >
+struct to_index_sequence<sequence<I...>>
+{
+    using type = index_sequence<static_cast<std::size_t>(I)...>;
+};
+
+/**
+ * @brief Convert any integer_sequence into index_sequence with the same values.
+ * For index_sequence itself it is an identity, so no new type is instantiated.
+ */
+template <
+        typename T,
+        T... I
+        >
+struct to_index_sequence<integer_sequence<T, I...>>
+{
+    using type = index_sequence<static_cast<std::size_t>(I)...>;
+};
+
+//forward declaration
+template <typename>
+struct to_sequence;
+
+/**
+ * @brief Convert any integer_sequence (e.g. index_sequence) into sequence of int's.
+ */
+template <
+        typename T,
+        T... I
+        >
+struct to_sequence<integer_sequence<T, I...>>
+{
+    using type = sequence<static_cast<int>(I)...>;
+};
+
 } //namespace tuple_utils
 
 #endif // SEQUENCE_HPP
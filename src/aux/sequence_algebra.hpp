@@ -0,0 +1,530 @@
+#ifndef SEQUENCE_ALGEBRA_HPP
+#define SEQUENCE_ALGEBRA_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include "sequence.hpp"
+
+/**
+ * @file
+ * @author
+ * @version
+*/
+
+//! Utilities for tuples manipulation
+namespace tuple_utils
+{
+
+///@internal
+namespace details
+{
+
+//forward declaration
+template <typename>
+struct sequence_array;
+
+/**
+ * @brief Keep values of index_sequence in constexpr array, so they could be read by index.
+ * Every operation on index sequences reads values from this array with a pack expansion over
+ * make_index_sequence, so each operation costs one instantiation instead of a recursive chain.
+ * Array contains one more element (sentinel) so it is never empty.
+ */
+template <
+        std::size_t... I
+        >
+struct sequence_array<index_sequence<I...>>
+{
+    static constexpr std::size_t size = sizeof...(I);
+    static constexpr std::size_t value[sizeof...(I) + 1] = {I..., 0};
+};
+
+template <
+        std::size_t... I
+        >
+constexpr std::size_t sequence_array<index_sequence<I...>>::value[sizeof...(I) + 1];
+
+/**
+ * @brief Helper struct used to check if all bool values in the pack are true without recursion
+ */
+template <bool...>
+struct bool_pack;
+
+/**
+ * @brief Check if all values from the pack are true
+ */
+template <
+        bool... B
+        >
+struct all_of : std::is_same<bool_pack<true, B...>, bool_pack<B..., true>>
+{ };
+
+/**
+ * @brief Count values in range [begin, end) for which predicate Pred is true.
+ * Range is divided in halves, so the recursion depth of constant evaluation is logarithmic.
+ */
+template <
+        typename Pred
+        >
+constexpr std::size_t count_if(const std::size_t* values, std::size_t begin, std::size_t end)
+{
+    return end - begin == 0 ? 0
+        : end - begin == 1 ? (Pred()(values[begin]) ? 1 : 0)
+        : count_if<Pred>(values, begin, begin + (end - begin) / 2)
+            + count_if<Pred>(values, begin + (end - begin) / 2, end);
+}
+
+/**
+ * @brief Count occurrences of value x in range [begin, end), range is divided in halves as in count_if.
+ */
+constexpr std::size_t count_value(const std::size_t* values, std::size_t begin, std::size_t end, std::size_t x)
+{
+    return end - begin == 0 ? 0
+        : end - begin == 1 ? (values[begin] == x ? 1 : 0)
+        : count_value(values, begin, begin + (end - begin) / 2, x)
+            + count_value(values, begin + (end - begin) / 2, end, x);
+}
+
+//forward declaration
+template <
+        typename Pred
+        >
+constexpr std::size_t find_nth_if(const std::size_t* values, std::size_t begin, std::size_t end, std::size_t n);
+
+/**
+ * @brief Continue find_nth_if in one of the halves of range [begin, end) split at mid.
+ * @param left - number of values in [begin, mid) for which Pred is true
+ */
+template <
+        typename Pred
+        >
+constexpr std::size_t find_nth_if_split(const std::size_t* values, std::size_t begin, std::size_t mid,
+                                        std::size_t end, std::size_t n, std::size_t left)
+{
+    return n < left ? find_nth_if<Pred>(values, begin, mid, n) : find_nth_if<Pred>(values, mid, end, n - left);
+}
+
+/**
+ * @brief Find position of n-th (counting from zero) value in range [begin, end) for which Pred is true.
+ * Range has to contain at least n+1 such values.
+ */
+template <
+        typename Pred
+        >
+constexpr std::size_t find_nth_if(const std::size_t* values, std::size_t begin, std::size_t end, std::size_t n)
+{
+    return end - begin == 1 ? begin
+        : find_nth_if_split<Pred>(values, begin, begin + (end - begin) / 2, end, n,
+                                  count_if<Pred>(values, begin, begin + (end - begin) / 2));
+}
+
+//forward declaration
+constexpr std::size_t find_value(const std::size_t* values, std::size_t begin, std::size_t end, std::size_t x);
+
+/**
+ * @brief Continue find_value in range [mid, end) if x was not found in the left half.
+ * @param left - result of find_value for the left half, equal to mid if x was not found there
+ */
+constexpr std::size_t find_value_split(const std::size_t* values, std::size_t mid, std::size_t end,
+                                       std::size_t x, std::size_t left)
+{
+    return left != mid ? left : find_value(values, mid, end, x);
+}
+
+/**
+ * @brief Find position of value x in range [begin, end), return end if it is not present.
+ */
+constexpr std::size_t find_value(const std::size_t* values, std::size_t begin, std::size_t end, std::size_t x)
+{
+    return end - begin == 0 ? end
+        : end - begin == 1 ? (values[begin] == x ? begin : end)
+        : find_value_split(values, begin + (end - begin) / 2, end, x,
+                           find_value(values, begin, begin + (end - begin) / 2, x));
+}
+
+/**
+ * @brief Sum of values in range [begin, end), range is divided in halves as in count_if
+ */
+constexpr std::size_t sum(const std::size_t* values, std::size_t begin, std::size_t end)
+{
+    return end - begin == 0 ? 0
+        : end - begin == 1 ? values[begin]
+        : sum(values, begin, begin + (end - begin) / 2) + sum(values, begin + (end - begin) / 2, end);
+}
+
+/**
+ * @brief Product of values in range [begin, end), one for an empty range, divided in halves as sum
+ */
+constexpr std::size_t product(const std::size_t* values, std::size_t begin, std::size_t end)
+{
+    return end - begin == 0 ? 1
+        : end - begin == 1 ? values[begin]
+        : product(values, begin, begin + (end - begin) / 2) * product(values, begin + (end - begin) / 2, end);
+}
+
+/**
+ * @brief Get j-th coordinate of k-th element of the Cartesian product of packs with given sizes.
+ * Elements are ordered as nested loops with the last pack in the innermost loop, so the j-th
+ * coordinate changes every product(sizes, j + 1, count) elements.
+ */
+constexpr std::size_t product_coordinate(const std::size_t* sizes, std::size_t count, std::size_t j, std::size_t k)
+{
+    return k / product(sizes, j + 1, count) % sizes[j];
+}
+
+/**
+ * @brief Check if k-th element of the Cartesian product is the last one which uses its j-th coordinate.
+ * It is the case when all other coordinates are the greatest ones: all coordinates after j are
+ * checked by the remainder of the stride of j, all coordinates before j by the quotient.
+ */
+constexpr bool product_last_use(const std::size_t* sizes, std::size_t count, std::size_t j, std::size_t k)
+{
+    return k % product(sizes, j + 1, count) == product(sizes, j + 1, count) - 1
+        && k / product(sizes, j, count) == product(sizes, 0, j) - 1;
+}
+
+/**
+ * @brief Get index of the element of the Cartesian product with given coordinates in range [begin, end),
+ * inverse of product_coordinate. Range is divided in halves: index of the left half is scaled by the
+ * number of elements of the product of the right half.
+ */
+constexpr std::size_t product_position(const std::size_t* sizes, const std::size_t* coordinates,
+                                       std::size_t begin, std::size_t end)
+{
+    return end - begin == 0 ? 0
+        : end - begin == 1 ? coordinates[begin]
+        : product_position(sizes, coordinates, begin, begin + (end - begin) / 2)
+            * product(sizes, begin + (end - begin) / 2, end)
+            + product_position(sizes, coordinates, begin + (end - begin) / 2, end);
+}
+
+//forward declaration
+constexpr std::size_t concat_source(const std::size_t* sizes, std::size_t begin, std::size_t end, std::size_t k);
+
+/**
+ * @brief Continue concat_source in the half of range [begin, end) split at mid which contains element k
+ * @param left - sum of sizes in [begin, mid)
+ */
+constexpr std::size_t concat_source_split(const std::size_t* sizes, std::size_t begin, std::size_t mid,
+                                          std::size_t end, std::size_t k, std::size_t left)
+{
+    return k < left ? concat_source(sizes, begin, mid, k) : concat_source(sizes, mid, end, k - left);
+}
+
+/**
+ * @brief Find which of the concatenated packs with given sizes contains k-th element of the concatenation.
+ * k has to be less than the sum of sizes in [begin, end).
+ */
+constexpr std::size_t concat_source(const std::size_t* sizes, std::size_t begin, std::size_t end, std::size_t k)
+{
+    return end - begin == 1 ? begin
+        : concat_source_split(sizes, begin, begin + (end - begin) / 2, end, k,
+                              sum(sizes, begin, begin + (end - begin) / 2));
+}
+
+/**
+ * @brief Get position of k-th element of the concatenation inside the pack which contains it.
+ */
+constexpr std::size_t concat_offset(const std::size_t* sizes, std::size_t count, std::size_t k)
+{
+    return k - sum(sizes, 0, concat_source(sizes, 0, count, k));
+}
+
+//forward declaration
+template <
+        typename Sizes,
+        typename
+        >
+struct concat_indices_det;
+
+/**
+ * @brief Compute source and offset index maps for the concatenation of packs with given sizes
+ */
+template <
+        std::size_t... S,
+        std::size_t... K
+        >
+struct concat_indices_det<index_sequence<S...>, index_sequence<K...>>
+{
+    using source = index_sequence<concat_source(
+        sequence_array<index_sequence<S...>>::value, 0, sizeof...(S), K
+    )...>;
+    using offset = index_sequence<concat_offset(
+        sequence_array<index_sequence<S...>>::value, sizeof...(S), K
+    )...>;
+};
+
+/**
+ * @brief Describe where each element of the concatenation of packs (e.g. tuples) with sizes S... comes from.
+ * For the k-th element of the concatenation, k-th value of source is the index of the pack which
+ * contains it and k-th value of offset is the index of the element inside that pack. Both maps are
+ * computed with one pack expansion each.
+ *
+ * Example: for sizes 2, 0, 1 source is 0, 0, 2 and offset is 0, 1, 0
+ */
+template <
+        std::size_t... S
+        >
+struct concat_indices : concat_indices_det<
+        index_sequence<S...>,
+        make_index_sequence<sum(sequence_array<index_sequence<S...>>::value, 0, sizeof...(S))>
+    >
+{ };
+
+//forward declaration
+template <
+        typename Sizes,
+        std::size_t K,
+        typename
+        >
+struct product_indices_det;
+
+/**
+ * @brief Compute coordinates and last use flags of K-th element of the Cartesian product
+ */
+template <
+        std::size_t... S,
+        std::size_t K,
+        std::size_t... J
+        >
+struct product_indices_det<index_sequence<S...>, K, index_sequence<J...>>
+{
+    using coordinates = index_sequence<product_coordinate(
+        sequence_array<index_sequence<S...>>::value, sizeof...(S), J, K
+    )...>;
+    using last_use = index_sequence<product_last_use(
+        sequence_array<index_sequence<S...>>::value, sizeof...(S), J, K
+    )...>;
+};
+
+/**
+ * @brief Describe K-th element of the Cartesian product of packs (e.g. tuples) with sizes S...
+ * J-th value of coordinates is the index of the element taken from J-th pack, J-th value of last_use
+ * is 1 if no later element of the product uses that element. Each map is computed with one pack
+ * expansion, independently for each K.
+ *
+ * Example: for sizes 2, 3 and K = 4 coordinates are 1, 1 and last_use is 0, 1
+ */
+template <
+        std::size_t K,
+        std::size_t... S
+        >
+struct product_indices : product_indices_det<index_sequence<S...>, K, make_index_sequence<sizeof...(S)>>
+{ };
+
+//forward declaration
+template <typename>
+struct reverse_positions;
+
+/**
+ * @brief Create positions N-1, N-2,..., 0 from positions 0, 1,..., N-1
+ */
+template <
+        std::size_t... J
+        >
+struct reverse_positions<index_sequence<J...>>
+{
+    using type = index_sequence<(sizeof...(J) - 1 - J)...>;
+};
+
+//forward declaration
+template <
+        typename Seq,
+        std::size_t Begin,
+        typename
+        >
+struct sequence_slice_det;
+
+/**
+ * @brief Take values from Seq at positions Begin + J for each J
+ */
+template <
+        typename Seq,
+        std::size_t Begin,
+        std::size_t... J
+        >
+struct sequence_slice_det<Seq, Begin, index_sequence<J...>>
+{
+    using type = index_sequence<sequence_array<Seq>::value[Begin + J]...>;
+};
+
+//forward declaration
+template <
+        typename Seq,
+        typename Pred,
+        typename
+        >
+struct sequence_filter_det;
+
+/**
+ * @brief Take values from Seq for which Pred is true, J-th value of result is J-th value which satisfy Pred
+ */
+template <
+        typename Seq,
+        typename Pred,
+        std::size_t... J
+        >
+struct sequence_filter_det<Seq, Pred, index_sequence<J...>>
+{
+    using type = index_sequence<sequence_array<Seq>::value[
+        find_nth_if<Pred>(sequence_array<Seq>::value, 0, sequence_array<Seq>::size, J)
+    ]...>;
+};
+
+//forward declaration
+template <
+        typename Seq,
+        typename
+        >
+struct sequence_invert_det;
+
+/**
+ * @brief J-th value of the result is the position of value J in Seq
+ */
+template <
+        typename Seq,
+        std::size_t... J
+        >
+struct sequence_invert_det<Seq, index_sequence<J...>>
+{
+    static_assert(all_of<(find_value(sequence_array<Seq>::value, 0, sizeof...(J), J) < sizeof...(J))...>::value,
+                  "Sequence is not a permutation");
+    using type = index_sequence<find_value(sequence_array<Seq>::value, 0, sizeof...(J), J)...>;
+};
+
+} //namespace details
+///@endinternal
+
+//forward declaration
+template <typename...>
+struct sequence_cat;
+
+/**
+ * @brief Concatenate any number of index sequences, e.g. <0, 2> and <1> into <0, 2, 1>.
+ * Each step concatenates two whole sequences with one pack expansion, so the recursion depth is
+ * equal to the number of sequences and does not depend on their lengths.
+ */
+template <
+        std::size_t... I,
+        std::size_t... J,
+        typename... Rest
+        >
+struct sequence_cat<index_sequence<I...>, index_sequence<J...>, Rest...> :
+        sequence_cat<index_sequence<I..., J...>, Rest...>
+{ };
+
+/**
+ * @brief Last step of sequence_cat, only one sequence is left
+ */
+template <
+        std::size_t... I
+        >
+struct sequence_cat<index_sequence<I...>>
+{
+    using type = index_sequence<I...>;
+};
+
+/**
+ * @brief Concatenation of zero sequences gives an empty sequence
+ */
+template <>
+struct sequence_cat<>
+{
+    using type = index_sequence<>;
+};
+
+/**
+ * @brief Take values of Seq from position Begin to position End (excluding End).
+ * Example: sequence_slice<index_sequence<5, 6, 7, 8>, 1, 3>::type is index_sequence<6, 7>
+ */
+template <
+        typename Seq,
+        std::size_t Begin,
+        std::size_t End = details::sequence_array<Seq>::size
+        >
+struct sequence_slice
+{
+    static_assert(Begin <= End && End <= details::sequence_array<Seq>::size, "Invalid slice");
+    using type = typename details::sequence_slice_det<Seq, Begin, make_index_sequence<End - Begin>>::type;
+};
+
+/**
+ * @brief Take values of Seq for which predicate Pred is true, keeping their order.
+ * Pred is a literal type with constexpr operator()(std::size_t) const. It is evaluated by constant
+ * expressions, so no class template is instantiated per value.
+ *
+ * Example:
+ * @code
+ * struct is_odd { constexpr bool operator()(std::size_t i) const { return i % 2; } };
+ * using odd = sequence_filter<make_index_sequence<6>, is_odd>::type; //index_sequence<1, 3, 5>
+ * @endcode
+ */
+template <
+        typename Seq,
+        typename Pred
+        >
+struct sequence_filter
+{
+    using type = typename details::sequence_filter_det<
+        Seq,
+        Pred,
+        make_index_sequence<details::count_if<Pred>(details::sequence_array<Seq>::value, 0, details::sequence_array<Seq>::size)>
+    >::type;
+};
+
+/**
+ * @brief Compose two index maps, J-th value of result is equal to Outer[Inner[J]].
+ * If Outer and Inner are used to pick elements from a tuple (as in make_custom_tuple), picking by
+ * Outer and then by Inner is the same as picking once by the composed sequence.
+ */
+template <
+        typename Outer,
+        typename Inner
+        >
+struct sequence_compose;
+
+/**
+ * @brief Read Outer values at positions given by Inner
+ */
+template <
+        typename Outer,
+        std::size_t... J
+        >
+struct sequence_compose<Outer, index_sequence<J...>>
+{
+    static_assert(details::all_of<(J < details::sequence_array<Outer>::size)...>::value, "Too big indice");
+    using type = index_sequence<details::sequence_array<Outer>::value[J]...>;
+};
+
+/**
+ * @brief Reverse order of values in Seq, e.g. <4, 1, 2> into <2, 1, 4>.
+ */
+template <
+        typename Seq
+        >
+struct sequence_reverse
+{
+    using type = typename sequence_compose<
+        Seq,
+        typename details::reverse_positions<make_index_sequence<details::sequence_array<Seq>::size>>::type
+    >::type;
+};
+
+/**
+ * @brief Invert permutation Seq, J-th value of result is the position of J in Seq.
+ * Composition of a permutation and its inverse gives 0, 1, 2,..., N-1.
+ * Example: sequence_invert<index_sequence<2, 0, 1>>::type is index_sequence<1, 2, 0>
+ */
+template <
+        typename Seq
+        >
+struct sequence_invert
+{
+    using type = typename details::sequence_invert_det<
+        Seq,
+        make_index_sequence<details::sequence_array<Seq>::size>
+    >::type;
+};
+
+} //namespace tuple_utils
+
+#endif // SEQUENCE_ALGEBRA_HPP
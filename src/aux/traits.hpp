@@ -1,8 +1,14 @@
 #ifndef TRAITS_HPP
 #define TRAITS_HPP
 
+#include <cstddef>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 #include "static.hpp"
+#include "sequence.hpp"
+#include "sequence_algebra.hpp"
+#include "type_list.hpp"
 
 /**
  * @file
@@ -15,46 +21,175 @@ namespace tuple_utils
 {
 
 /**
- * @brief Obtains smallest size for the number of given tuples
+ * @brief Give size of bare Tuple type (stripped from cv qualifiers and references)
  */
-template <typename T, typename... Args>
-struct tsize_min : private static_
+template <
+        typename Tuple
+        >
+struct size_bare
 {
-    using CT = typename std::decay<T>::type;
-    static constexpr std::size_t value = std::tuple_size<CT>::value < tsize_min<Args...>::value
-        ? std::tuple_size<CT>::value : tsize_min<Args...>::value;
+    static constexpr auto value = std::tuple_size<typename std::decay<Tuple>::type>::value;
 };
 
+///@internal
+namespace details
+{
+
 /**
- * @brief Last step of recursive tsize_min<>::value, value is equal to the size of smaller tuple
+ * @brief Smaller of two values, std::min is not constexpr in C++11
  */
-template <typename T, typename Y>
-struct tsize_min<T, Y> : private static_
+constexpr std::size_t smaller(std::size_t x, std::size_t y)
 {
-    using CT = typename std::decay<T>::type;
-    using CY = typename std::decay<Y>::type;
-    static constexpr std::size_t value = std::tuple_size<CT>::value < std::tuple_size<CY>::value
-        ? std::tuple_size<CT>::value : std::tuple_size<CY>::value;
-};
+    return x < y ? x : y;
+}
+
+/**
+ * @brief Greater of two values, std::max is not constexpr in C++11
+ */
+constexpr std::size_t greater(std::size_t x, std::size_t y)
+{
+    return x < y ? y : x;
+}
+
+/**
+ * @brief Smallest value in range [begin, end), range has to be non-empty.
+ * Range is divided in halves, so the recursion depth of constant evaluation is logarithmic.
+ */
+constexpr std::size_t min_value(const std::size_t* values, std::size_t begin, std::size_t end)
+{
+    return end - begin == 1 ? values[begin]
+        : smaller(min_value(values, begin, begin + (end - begin) / 2), min_value(values, begin + (end - begin) / 2, end));
+}
+
+/**
+ * @brief Greatest value in range [begin, end), zero for an empty range.
+ */
+constexpr std::size_t max_value(const std::size_t* values, std::size_t begin, std::size_t end)
+{
+    return end - begin == 0 ? 0
+        : end - begin == 1 ? values[begin]
+        : greater(max_value(values, begin, begin + (end - begin) / 2), max_value(values, begin + (end - begin) / 2, end));
+}
+
+/**
+ * @brief Constexpr array with sizes of all given tuples
+ */
+template <
+        typename... Tuples
+        >
+struct tuple_sizes : sequence_array<index_sequence<size_bare<Tuples>::value...>>
+{ };
+
+} //namespace details
+///@endinternal
+
+/**
+ * @brief Obtains smallest size for the number of given tuples
+ * Sizes of all tuples are put into one constexpr array and the minimum is computed with one
+ * constant evaluation, so no template is instantiated per argument.
+ */
+template <
+        typename T,
+        typename... Args
+        >
+struct tsize_min :
+        std::integral_constant<std::size_t, details::min_value(
+            details::tuple_sizes<T, Args...>::value, 0, details::tuple_sizes<T, Args...>::size
+        )>,
+        private static_
+{ };
+
+/**
+ * @brief Obtains greatest size for the number of given tuples, zero if no tuple is given
+ */
+template <
+        typename... Tuples
+        >
+struct tsize_max :
+        std::integral_constant<std::size_t, details::max_value(
+            details::tuple_sizes<Tuples...>::value, 0, details::tuple_sizes<Tuples...>::size
+        )>,
+        private static_
+{ };
+
+/**
+ * @brief Obtains sum of sizes of given tuples, i.e. the size of those tuples merged together
+ */
+template <
+        typename... Tuples
+        >
+struct tsize_sum :
+        std::integral_constant<std::size_t, details::sum(
+            details::tuple_sizes<Tuples...>::value, 0, details::tuple_sizes<Tuples...>::size
+        )>,
+        private static_
+{ };
 
 /**
- * @brief Special case when tsize_min is parameterized with only one type
- * Derives from std::integral_constant to get value member of type std::size_t with value equal
- * to std::tuple_size<>::value
+ * @brief Obtains product of sizes of given tuples, i.e. the number of elements of their Cartesian product
  */
-template <typename T>
-struct tsize_min<T> :
-        std::integral_constant<std::size_t, std::tuple_size<typename std::decay<T>::type>::value>,
+template <
+        typename... Tuples
+        >
+struct tsize_product :
+        std::integral_constant<std::size_t, details::product(
+            details::tuple_sizes<Tuples...>::value, 0, details::tuple_sizes<Tuples...>::size
+        )>,
         private static_
 { };
 
+///@internal
+namespace details
+{
+
+/**
+ * @brief Check if function of type FuncType could be called with arguments of types Args...
+ * Args are interpreted as for std::declval, non-reference types and rvalue references denote rvalues.
+ */
+template <
+        typename FuncType,
+        typename... Args
+        >
+struct is_callable
+{
+    template <typename F>
+    static auto check(int) -> decltype(std::declval<F&>()(std::declval<Args>()...), std::true_type());
+
+    template <typename F>
+    static std::false_type check(...);
+
+    static constexpr bool value = decltype(check<FuncType>(0))::value;
+};
+
+/**
+ * @brief Get return value of f(args...), arguments keep their value categories if f accepts them
+ * Otherwise all arguments are passed as lvalues, so functions taking their arguments by non-const
+ * reference still could be used. Member forward tells which way was chosen.
+ */
+template <
+        typename FuncType,
+        typename... Args
+        >
+struct call_result
+{
+    static constexpr bool forward = is_callable<FuncType, Args...>::value;
+    using type = decltype(std::declval<FuncType&>()(
+        std::declval<typename std::conditional<forward, Args&&, Args&>::type>()...
+    ));
+};
+
+} //namespace details
+///@endinternal
+
 //Forward declaration
 template <typename...>
 struct result_of_rec;
 
 /**
  * @brief Trait used to get return value of a recursive binary function call f(x, f(y, ...f(z1, fz2)))
- * Function f could take it's arguments by value, reference or both
+ * Function f could take it's arguments by value, reference or both. Arguments are passed with value
+ * categories given by their types (as for std::declval) and the result of the recursive call is passed
+ * as an rvalue, unless f does not accept them, then all arguments are passed as lvalues.
  * @tparam FuncType - function type, could be function pointer, lambda or functor
  * @tparam F - first argument
  * @tparam R... - rest of the arguments, used in recursive call
@@ -66,10 +201,11 @@ template <
         >
 struct result_of_rec<FuncType, F, R...> : private static_
 {
-    using type = decltype(std::declval<FuncType>()(
-        std::declval<typename std::add_lvalue_reference<F>::type>(),
-        std::declval<typename std::add_lvalue_reference<typename result_of_rec<FuncType, R...>::type>::type>()
-    ));
+    using type = typename details::call_result<
+        FuncType,
+        F,
+        typename std::decay<typename result_of_rec<FuncType, R...>::type>::type
+    >::type;
 };
 
 /**
@@ -82,10 +218,7 @@ template <
         >
 struct result_of_rec<FuncType, T, Y> : private static_
 {
-    using type = decltype(std::declval<FuncType>()(
-        std::declval<typename std::add_lvalue_reference<T>::type>(),
-        std::declval<typename std::add_lvalue_reference<Y>::type>()
-    ));
+    using type = typename details::call_result<FuncType, T, Y>::type;
 };
 
 /**
@@ -97,46 +230,166 @@ template <
         >
 struct result_of_rec<FuncType, T> : private static_
 {
-    using type = decltype(std::declval<FuncType>()(std::declval<typename std::add_lvalue_reference<T>::type>()));
+    using type = typename details::call_result<FuncType, T>::type;
 };
 
+//Forward declaration
+template <typename...>
+struct result_of_left;
+
 /**
- * @brief Check if any type passed as template parameter is empty
+ * @brief Trait used to get return value of a left fold f(f(f(x, y), ...), z) of a binary function
+ * Arguments are passed as for result_of_rec, the result of each call is passed on as an rvalue.
+ * @tparam FuncType - function type, could be function pointer, lambda or functor
+ * @tparam T, Y - the first two arguments, folded first
+ * @tparam Z, R... - rest of the arguments
  */
 template <
+        typename FuncType,
         typename T,
-        typename... Rest
+        typename Y,
+        typename Z,
+        typename... R
+        >
+struct result_of_left<FuncType, T, Y, Z, R...> :
+        result_of_left<FuncType, typename std::decay<typename details::call_result<FuncType, T, Y>::type>::type, Z, R...>
+{ };
+
+/**
+ * @brief Last step of result_of_left, type set to the return value of a binary function f(x,y)
+ */
+template <
+        typename FuncType,
+        typename T,
+        typename Y
         >
-struct contain_empty : private static_
+struct result_of_left<FuncType, T, Y> : private static_
 {
-    using CT = typename std::decay<T>::type;
-    static constexpr bool value = !std::tuple_size<CT>::value || contain_empty<Rest...>::value;
+    using type = typename details::call_result<FuncType, T, Y>::type;
 };
 
 /**
- * @ Check if type passed as template parameter is empty
- * Last step in recursive contain_empty check.
+ * @brief Get return value of unary function f(x), as for result_of_rec
  */
 template <
+        typename FuncType,
         typename T
         >
-struct contain_empty<T> : private static_
+struct result_of_left<FuncType, T> : private static_
 {
-    using CT = typename std::decay<T>::type;
-    static constexpr bool value = !std::tuple_size<CT>::value;
+    using type = typename details::call_result<FuncType, T>::type;
 };
 
+///@internal
+namespace details
+{
+
+//Forward declaration
+template <
+        typename FuncType,
+        typename List,
+        std::size_t Begin,
+        std::size_t End
+        >
+struct tree_call_result;
+
 /**
- * @brief Give size of bare Tuple type (stripped from cv qualifiers and references)
+ * @brief Type of argument passed by a tree fold for arguments in range [Begin, End) of List
+ * A single argument is passed as it is, the result of folding more arguments is passed as an rvalue.
  */
 template <
-        typename Tuple
+        typename FuncType,
+        typename List,
+        std::size_t Begin,
+        std::size_t End,
+        bool Single = End - Begin == 1
         >
-struct size_bare
+struct tree_operand
 {
-    static constexpr auto value = std::tuple_size<typename std::decay<Tuple>::type>::value;
+    using type = typename std::decay<typename tree_call_result<FuncType, List, Begin, End>::type>::type;
+};
+
+template <
+        typename FuncType,
+        typename List,
+        std::size_t Begin,
+        std::size_t End
+        >
+struct tree_operand<FuncType, List, Begin, End, true>
+{
+    using type = typename type_at<Begin, List>::type;
+};
+
+/**
+ * @brief Return value of f called for folded halves of range [Begin, End) of List, at least two arguments long
+ */
+template <
+        typename FuncType,
+        typename List,
+        std::size_t Begin,
+        std::size_t End
+        >
+struct tree_call_result
+{
+    static constexpr std::size_t middle = Begin + (End - Begin) / 2;
+    using type = typename call_result<
+        FuncType,
+        typename tree_operand<FuncType, List, Begin, middle>::type,
+        typename tree_operand<FuncType, List, middle, End>::type
+    >::type;
 };
 
+} //namespace details
+///@endinternal
+
+//Forward declaration
+template <typename...>
+struct result_of_tree;
+
+/**
+ * @brief Trait used to get return value of a balanced tree fold of a binary function
+ * Arguments are split in halves, both halves are folded independently and their results are passed
+ * to f as rvalues, e.g. f(f(x1, x2), f(x3, x4)) for four arguments and f(x1, f(x2, x3)) for three.
+ * Depth of the calls is logarithmic, so independent calls could be executed in parallel by the CPU.
+ * @tparam FuncType - function type, could be function pointer, lambda or functor
+ * @tparam T, Y, R... - arguments, at least two
+ */
+template <
+        typename FuncType,
+        typename T,
+        typename Y,
+        typename... R
+        >
+struct result_of_tree<FuncType, T, Y, R...> :
+        details::tree_call_result<FuncType, type_list<T, Y, R...>, 0, sizeof...(R) + 2>,
+        private static_
+{ };
+
+/**
+ * @brief Get return value of unary function f(x), as for result_of_rec
+ */
+template <
+        typename FuncType,
+        typename T
+        >
+struct result_of_tree<FuncType, T> : private static_
+{
+    using type = typename details::call_result<FuncType, T>::type;
+};
+
+/**
+ * @brief Check if any type passed as template parameter is empty
+ * Equivalent to checking if the smallest size is equal to zero.
+ */
+template <
+        typename T,
+        typename... Rest
+        >
+struct contain_empty :
+        std::integral_constant<bool, tsize_min<T, Rest...>::value == 0>,
+        private static_
+{ };
+
 } // namespace tuple_utils
 
 #endif // TRAITS_HPP
@@ -0,0 +1,304 @@
+#ifndef TYPE_LIST_HPP
+#define TYPE_LIST_HPP
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include "sequence.hpp"
+#include "sequence_algebra.hpp"
+
+/**
+ * @file
+ * @author
+ * @version
+*/
+
+//! Utilities for tuples manipulation
+namespace tuple_utils
+{
+
+/**
+ * @brief Class parametrized with variable number of types, used only to keep those types.
+ * It is the internal representation of std::tuple types used by tuple_utils metafunctions.
+ */
+template <
+        typename... T
+        >
+struct type_list
+{
+    static constexpr std::size_t size = sizeof...(T);
+};
+
+///@internal
+namespace details
+{
+
+/**
+ * @brief Single base of type_indexer, binds type T with its index I
+ */
+template <
+        std::size_t I,
+        typename T
+        >
+struct indexed_type
+{
+    using type = T;
+};
+
+//forward declaration
+template <
+        typename,
+        typename...
+        >
+struct type_indexer;
+
+/**
+ * @brief Derive from indexed_type<I, T> for each type from the list at once.
+ * Base indexed_type<I, T> is then selected by overload resolution with I given explicitly, so
+ * the type at index I is found by the compiler in a constant number of instantiations instead of
+ * I recursive steps.
+ */
+template <
+        std::size_t... I,
+        typename... T
+        >
+struct type_indexer<index_sequence<I...>, T...> : indexed_type<I, T>...
+{ };
+
+/**
+ * @brief Select base of type_indexer with the index I, only declared, used inside decltype
+ */
+template <
+        std::size_t I,
+        typename T
+        >
+indexed_type<I, T> select_type(const indexed_type<I, T>*);
+
+} //namespace details
+///@endinternal
+
+//forward declaration
+template <
+        std::size_t I,
+        typename List
+        >
+struct type_at;
+
+/**
+ * @brief Get type at index I from type_list, equivalent of std::tuple_element for type_list.
+ * Depth of template instantiation does not depend on I nor on the size of the list.
+ */
+template <
+        std::size_t I,
+        typename... T
+        >
+struct type_at<I, type_list<T...>>
+{
+    static_assert(I < sizeof...(T), "Too big indice");
+    using type = typename decltype(details::select_type<I>(
+        static_cast<const details::type_indexer<index_sequence_for<T...>, T...>*>(nullptr)
+    ))::type;
+};
+
+//forward declaration
+template <typename>
+struct to_type_list;
+
+/**
+ * @brief Get type_list with types of std::tuple
+ */
+template <
+        typename... T
+        >
+struct to_type_list<std::tuple<T...>>
+{
+    using type = type_list<T...>;
+};
+
+/**
+ * @brief Get type_list with both types of std::pair
+ */
+template <
+        typename T,
+        typename Y
+        >
+struct to_type_list<std::pair<T, Y>>
+{
+    using type = type_list<T, Y>;
+};
+
+/**
+ * @brief type_list is already a type_list
+ */
+template <
+        typename... T
+        >
+struct to_type_list<type_list<T...>>
+{
+    using type = type_list<T...>;
+};
+
+//forward declaration
+template <typename>
+struct to_tuple;
+
+/**
+ * @brief Get std::tuple with types from type_list
+ */
+template <
+        typename... T
+        >
+struct to_tuple<type_list<T...>>
+{
+    using type = std::tuple<T...>;
+};
+
+/**
+ * @brief Get type at index I from std::tuple, equivalent of std::tuple_element with constant depth.
+ * Used instead of std::tuple_element in tuple_utils metafunctions, because std::tuple_element is
+ * implemented recursively by some standard libraries.
+ */
+template <
+        std::size_t I,
+        typename Tuple
+        >
+struct tuple_type_at : type_at<I, typename to_type_list<Tuple>::type>
+{ };
+
+/**
+ * @brief Type of element of const std::tuple is const, as for std::tuple_element
+ */
+template <
+        std::size_t I,
+        typename Tuple
+        >
+struct tuple_type_at<I, const Tuple>
+{
+    using type = typename std::add_const<typename tuple_type_at<I, Tuple>::type>::type;
+};
+
+/**
+ * @brief References to std::tuple are stripped, so forwarded tuple types could be used directly
+ */
+template <
+        std::size_t I,
+        typename Tuple
+        >
+struct tuple_type_at<I, Tuple&> : tuple_type_at<I, Tuple>
+{ };
+
+/**
+ * @brief References to std::tuple are stripped, so forwarded tuple types could be used directly
+ */
+template <
+        std::size_t I,
+        typename Tuple
+        >
+struct tuple_type_at<I, Tuple&&> : tuple_type_at<I, Tuple>
+{ };
+
+///@internal
+namespace details
+{
+
+//forward declaration
+template <
+        typename Lists,
+        typename Source,
+        typename Offset
+        >
+struct type_list_pick;
+
+/**
+ * @brief Create type_list with k-th type taken from list Source[k] at index Offset[k]
+ */
+template <
+        typename... Lists,
+        std::size_t... Source,
+        std::size_t... Offset
+        >
+struct type_list_pick<type_list<Lists...>, index_sequence<Source...>, index_sequence<Offset...>>
+{
+    using type = type_list<typename type_at<Offset, typename type_at<Source, type_list<Lists...>>::type>::type...>;
+};
+
+} //namespace details
+///@endinternal
+
+/**
+ * @brief Concatenate any number of type_lists into one.
+ * Every type of the result is picked with the index maps from details::concat_indices, so the
+ * depth of template instantiation does not depend on the number of lists nor on their sizes.
+ */
+template <
+        typename... Lists
+        >
+struct type_list_cat
+{
+    using indices = details::concat_indices<Lists::size...>;
+    using type = typename details::type_list_pick<
+        type_list<Lists...>,
+        typename indices::source,
+        typename indices::offset
+    >::type;
+};
+
+///@internal
+namespace details
+{
+
+//forward declaration
+template <
+        typename Lists,
+        typename K
+        >
+struct type_list_product_det;
+
+/**
+ * @brief Create all combinations at once, K-th combination picks from each list the type at
+ * K-th coordinates given by details::product_indices
+ */
+template <
+        typename... Lists,
+        std::size_t... K
+        >
+struct type_list_product_det<type_list<Lists...>, index_sequence<K...>>
+{
+    using type = type_list<typename type_list_pick<
+        type_list<Lists...>,
+        index_sequence_for<Lists...>,
+        typename product_indices<K, Lists::size...>::coordinates
+    >::type...>;
+};
+
+} //namespace details
+///@endinternal
+
+/**
+ * @brief Cartesian product of type_lists, type_list of type_lists with one type from each list.
+ * Combinations are ordered as elements of tuple_utils::c_product, with the last list in the innermost
+ * loop, and are created with one pack expansion, so only types are involved, no values.
+ * Example:
+ * @code
+ *   using result = tuple_utils::type_list_product<
+ *       tuple_utils::type_list<float, double>,
+ *       tuple_utils::type_list<row_major, column_major>
+ *   >::type;
+ *   //result is type_list<type_list<float, row_major>, type_list<float, column_major>,
+ *   //                    type_list<double, row_major>, type_list<double, column_major>>
+ * @endcode
+ */
+template <
+        typename... Lists
+        >
+struct type_list_product : details::type_list_product_det<
+        type_list<Lists...>,
+        make_index_sequence<details::product(
+            details::sequence_array<index_sequence<Lists::size...>>::value, 0, sizeof...(Lists)
+        )>
+    >
+{ };
+
+} //namespace tuple_utils
+
+#endif // TYPE_LIST_HPP
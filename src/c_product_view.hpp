@@ -0,0 +1,373 @@
+#ifndef C_PRODUCT_VIEW_H
+#define C_PRODUCT_VIEW_H
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "aux/get.hpp"
+#include "aux/sequence.hpp"
+#include "aux/sequence_algebra.hpp"
+#include "aux/traits.hpp"
+#include "aux/type_list.hpp"
+
+/**
+ * @file
+ * @author
+ * @version
+*/
+
+//! Utilities for tuples manipulation
+namespace tuple_utils
+{
+
+//forward declaration
+template <typename... Tuples>
+struct c_product_view;
+
+///@internal
+namespace details
+{
+
+/**
+ * @brief Coordinates and last use flags of K-th element of Cartesian product of Tuples
+ */
+template <
+        std::size_t K,
+        typename... Tuples
+        >
+struct c_product_indices : product_indices<K, size_bare<Tuples>::value...>
+{ };
+
+//forward declaration
+template <
+        std::size_t K,
+        typename Sizes,
+        typename Positions,
+        typename... Tuples
+        >
+struct c_product_row_type_det;
+
+/**
+ * @brief Type of K-th materialized element of Cartesian product, std::tuple with copies of elements
+ * J-th coordinate is computed in place by product_coordinate and element types are taken from
+ * std::tuple_element, so each K costs one instantiation and no overload resolution.
+ */
+template <
+        std::size_t K,
+        std::size_t... S,
+        std::size_t... J,
+        typename... Tuples
+        >
+struct c_product_row_type_det<K, index_sequence<S...>, index_sequence<J...>, Tuples...>
+{
+    using type = std::tuple<typename std::decay<typename std::tuple_element<
+        product_coordinate(sequence_array<index_sequence<S...>>::value, sizeof...(S), J, K),
+        Tuples
+    >::type>::type...>;
+};
+
+/**
+ * @brief Type of K-th materialized element of Cartesian product of decayed Tuples
+ */
+template <
+        std::size_t K,
+        typename... Tuples
+        >
+struct c_product_row_type :
+        c_product_row_type_det<
+            K,
+            index_sequence<size_bare<Tuples>::value...>,
+            index_sequence_for<Tuples...>,
+            Tuples...
+        >
+{ };
+
+//forward declaration
+template <
+        typename Seq,
+        typename... Tuples
+        >
+struct c_product_type;
+
+/**
+ * @brief Type of the whole Cartesian product of Tuples (which could be references), one row for each K
+ * Rows are named directly by c_product_row_type_det, the same instantiations are used by c_product_det.
+ */
+template <
+        std::size_t... K,
+        typename... Tuples
+        >
+struct c_product_type<index_sequence<K...>, Tuples...>
+{
+    using type = std::tuple<typename c_product_row_type_det<
+        K,
+        index_sequence<size_bare<Tuples>::value...>,
+        index_sequence_for<Tuples...>,
+        typename std::decay<Tuples>::type...
+    >::type...>;
+};
+
+/**
+ * @brief Create std::tuple of references to elements at coordinates C... of tuples kept in refs
+ * References are lvalue references (const for const tuples), elements could be used many times.
+ */
+template <
+        std::size_t... C,
+        std::size_t... J,
+        typename... Tuples
+        >
+auto c_product_refs(index_sequence<C...>, index_sequence<J...>, const std::tuple<Tuples...>& refs)
+-> std::tuple<decltype(tuple_get<C>(std::get<J>(refs)))...>
+{
+    return std::tuple<decltype(tuple_get<C>(std::get<J>(refs)))...>(tuple_get<C>(std::get<J>(refs))...);
+}
+
+/**
+ * @brief Create K-th element of Cartesian product of tuples kept in refs, Row is its type
+ * Coordinates and last use flags are computed in place for each J. If Move is true then element of
+ * rvalue tuple is moved when it is used for the last time.
+ * @param sizes - sizes of the tuples
+ */
+template <
+        bool Move,
+        typename Row,
+        std::size_t K,
+        std::size_t... S,
+        std::size_t... J,
+        typename... Tuples
+        >
+Row c_product_value(index_sequence<S...>, index_sequence<J...>, const std::tuple<Tuples...>& refs)
+{
+    return Row(element_forwarder<
+                   Move && product_last_use(sequence_array<index_sequence<S...>>::value, sizeof...(S), J, K)
+               >::template get<
+                   product_coordinate(sequence_array<index_sequence<S...>>::value, sizeof...(S), J, K)
+               >(std::forward<Tuples>(std::get<J>(refs)))...);
+}
+
+/**
+ * @brief Create all elements of Cartesian product of tuples kept in refs with one pack expansion over K
+ * Rows are taken from the c_product_type named by the caller (passed as a null pointer), so each K
+ * instantiates only its row type and c_product_value.
+ * Braced initialization guarantees that elements are created in order, so the last use of an element
+ * of rvalue tuple is really the last one.
+ */
+template <
+        bool Move,
+        typename... Rows,
+        std::size_t... K,
+        typename... Tuples
+        >
+std::tuple<Rows...> c_product_det(std::tuple<Rows...>*, index_sequence<K...>, const std::tuple<Tuples...>& refs)
+{
+    return std::tuple<Rows...>{
+        c_product_value<Move, Rows, K>(
+            index_sequence<size_bare<Tuples>::value...>(),
+            index_sequence_for<Tuples...>(),
+            refs
+        )...
+    };
+}
+
+/**
+ * @brief References to tuples kept by c_product_view, copies of rvalue arguments are const
+ */
+template <
+        std::size_t... J,
+        typename... Tuples
+        >
+std::tuple<const Tuples&...> c_product_view_refs(index_sequence<J...>, const std::tuple<Tuples...>& tuples)
+{
+    return std::tuple<const Tuples&...>(std::get<J>(tuples)...);
+}
+
+/**
+ * @brief References to tuples kept by rvalue c_product_view, copies of rvalue arguments are rvalues
+ * and could be moved
+ */
+template <
+        std::size_t... J,
+        typename... Tuples
+        >
+std::tuple<Tuples&&...> c_product_view_refs(index_sequence<J...>, std::tuple<Tuples...>&& tuples)
+{
+    return std::tuple<Tuples&&...>(std::get<J>(std::move(tuples))...);
+}
+
+//forward declaration
+template <
+        typename View,
+        typename K
+        >
+struct c_product_view_types;
+
+/**
+ * @brief Types of all materialized elements of c_product_view
+ */
+template <
+        typename... Tuples,
+        std::size_t... K
+        >
+struct c_product_view_types<c_product_view<Tuples...>, index_sequence<K...>>
+{
+    using type = type_list<typename c_product_row_type<K, typename std::decay<Tuples>::type...>::type...>;
+};
+
+} //namespace details
+///@endinternal
+
+/**
+ * @brief Lazy Cartesian product of std::tuples which keeps only references to lvalue tuples.
+ * Behaves as the std::tuple returned by tuple_utils::c_product for the same (at least two) arguments,
+ * but elements are not copied. Rvalue tuples are moved into the view, as zipped_range keeps rvalue
+ * containers. Index K is decomposed at compile time into one index per viewed tuple, as nested loops
+ * with the last tuple in the innermost loop (see details::product_indices), so
+ * tuple_utils::get<K> creates only std::tuple of references to the elements which form K-th element.
+ * std::tuple_size and std::tuple_element are specialized, std::tuple_element gives types of
+ * materialized elements. c_product_view should not outlive the viewed lvalue tuples.
+ * @tparam Tuples - types of viewed std::tuples, lvalue references for lvalue arguments of make_c_product_view
+ */
+template <
+        typename... Tuples
+        >
+struct c_product_view
+{
+    /**
+     * @brief Create view of given std::tuples, usually called through tuple_utils::make_c_product_view
+     */
+    explicit c_product_view(Tuples&&... tuples)
+        : tuples(std::forward<Tuples>(tuples)...)
+    { }
+
+    /**
+     * @brief References to the viewed lvalue std::tuples and copies of rvalue ones
+     */
+    std::tuple<Tuples...> tuples;
+};
+
+/**
+ * @brief Create c_product_view of given std::tuples
+ * Example:
+ * @code
+ *    auto x = std::make_tuple(1, 2);
+ *    auto y = std::make_tuple('a', 'b', 'c');
+ *    auto view = tuple_utils::make_c_product_view(x, y);
+ *    tuple_utils::get<4>(view); //std::tuple<int&, char&> referencing std::get<1>(x) and std::get<1>(y)
+ * @endcode
+ */
+template <
+        typename... Tuples
+        >
+c_product_view<Tuples...> make_c_product_view(Tuples&&... tuples)
+{
+    return c_product_view<Tuples...>(std::forward<Tuples>(tuples)...);
+}
+
+/**
+ * @brief Get K-th element of c_product_view, std::tuple of lvalue references into the viewed tuples
+ * (const references into copies of rvalue tuples kept by the view)
+ */
+template <
+        std::size_t K,
+        typename... Tuples
+        >
+auto get(const c_product_view<Tuples...>& view)
+-> decltype(details::c_product_refs(
+                typename details::c_product_indices<K, Tuples...>::coordinates(),
+                index_sequence_for<Tuples...>(),
+                view.tuples
+            ))
+{
+    static_assert(K < tsize_product<Tuples...>::value, "Too big indice");
+    return details::c_product_refs(
+                typename details::c_product_indices<K, Tuples...>::coordinates(),
+                index_sequence_for<Tuples...>(),
+                view.tuples
+            );
+}
+
+/**
+ * @brief Create std::tuple with copies of all c_product_view elements, equal to the result of
+ * tuple_utils::c_product
+ */
+template <
+        typename... Tuples
+        >
+auto materialize(const c_product_view<Tuples...>& view)
+-> typename details::c_product_type<make_index_sequence<tsize_product<Tuples...>::value>, Tuples...>::type
+{
+    using result = typename details::c_product_type<
+        make_index_sequence<tsize_product<Tuples...>::value>,
+        Tuples...
+    >::type;
+    return details::c_product_det<false>(
+                static_cast<result*>(nullptr),
+                make_index_sequence<tsize_product<Tuples...>::value>(),
+                details::c_product_view_refs(index_sequence_for<Tuples...>(), view.tuples)
+            );
+}
+
+/**
+ * @brief Create std::tuple from rvalue c_product_view, elements of rvalue tuples moved into the view
+ * are moved on their last use
+ */
+template <
+        typename... Tuples
+        >
+auto materialize(c_product_view<Tuples...>&& view)
+-> typename details::c_product_type<make_index_sequence<tsize_product<Tuples...>::value>, Tuples...>::type
+{
+    using result = typename details::c_product_type<
+        make_index_sequence<tsize_product<Tuples...>::value>,
+        Tuples...
+    >::type;
+    return details::c_product_det<true>(
+                static_cast<result*>(nullptr),
+                make_index_sequence<tsize_product<Tuples...>::value>(),
+                details::c_product_view_refs(index_sequence_for<Tuples...>(), std::move(view.tuples))
+            );
+}
+
+/**
+ * @brief c_product_view elements are described by types of its materialized elements
+ */
+template <
+        typename... Tuples
+        >
+struct to_type_list<c_product_view<Tuples...>> :
+        details::c_product_view_types<
+            c_product_view<Tuples...>,
+            make_index_sequence<tsize_product<Tuples...>::value>
+        >
+{ };
+
+} //namespace tuple_utils
+
+namespace std
+{
+
+/**
+ * @brief Size of c_product_view is equal to the product of sizes of viewed tuples
+ */
+template <
+        typename... Tuples
+        >
+struct tuple_size<tuple_utils::c_product_view<Tuples...>> :
+        std::integral_constant<std::size_t, tuple_utils::tsize_product<Tuples...>::value>
+{ };
+
+/**
+ * @brief Type of K-th materialized element of c_product_view
+ */
+template <
+        std::size_t K,
+        typename... Tuples
+        >
+struct tuple_element<K, tuple_utils::c_product_view<Tuples...>> :
+        tuple_utils::details::c_product_row_type<K, typename std::decay<Tuples>::type...>
+{ };
+
+} //namespace std
+
+#endif // C_PRODUCT_VIEW_H
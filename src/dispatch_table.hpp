@@ -0,0 +1,195 @@
+#ifndef DISPATCH_TABLE_H
+#define DISPATCH_TABLE_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include "aux/sequence.hpp"
+#include "aux/sequence_algebra.hpp"
+#include "aux/type_list.hpp"
+
+/**
+ * @file
+ * @author
+ * @version
+*/
+
+//! Utilities for tuples manipulation
+namespace tuple_utils
+{
+
+///@internal
+namespace details
+{
+
+//forward declaration
+template <
+        typename Kernel,
+        typename Pointer,
+        typename Combination
+        >
+struct kernel_pointer;
+
+/**
+ * @brief Address of Kernel::apply instantiated for one combination of policy types
+ */
+template <
+        typename Kernel,
+        typename Pointer,
+        typename... Policies
+        >
+struct kernel_pointer<Kernel, Pointer, type_list<Policies...>>
+{
+    static constexpr Pointer value = &Kernel::template apply<Policies...>;
+};
+
+//forward declaration
+template <
+        typename Kernel,
+        typename Pointer,
+        typename Combinations
+        >
+struct kernel_pointers;
+
+/**
+ * @brief Array with addresses of Kernel::apply for all combinations, created with one pack expansion
+ */
+template <
+        typename Kernel,
+        typename Pointer,
+        typename... Combinations
+        >
+struct kernel_pointers<Kernel, Pointer, type_list<Combinations...>>
+{
+    static constexpr Pointer value[sizeof...(Combinations)] = {
+        kernel_pointer<Kernel, Pointer, Combinations>::value...
+    };
+};
+
+template <
+        typename Kernel,
+        typename Pointer,
+        typename... Combinations
+        >
+constexpr Pointer kernel_pointers<Kernel, Pointer, type_list<Combinations...>>::value[sizeof...(Combinations)];
+
+/**
+ * @brief Check that each of the first count choices is smaller than the size of its list
+ */
+constexpr bool choices_in_range(const std::size_t* extents, const std::size_t* choices, std::size_t count)
+{
+    return count == 0
+        || (choices[count - 1] < extents[count - 1] && choices_in_range(extents, choices, count - 1));
+}
+
+} //namespace details
+///@endinternal
+
+//forward declaration
+template <
+        typename Signature,
+        typename Kernel,
+        typename... Lists
+        >
+struct dispatch_table;
+
+/**
+ * @brief Table of pointers to Kernel::apply instantiated for every combination of policy types from Lists...
+ * Combinations are created with tuple_utils::type_list_product, so the index of a combination is
+ * computed from runtime choices (one index into each list) with multiplications only, and a kernel is
+ * selected with one indirect call instead of a cascade of branches. The table is a constexpr array.
+ * Choices are checked against the sizes of the lists, std::out_of_range is thrown for a wrong one.
+ * Kernel has to provide static member function template apply<Policies...> with signature R(Args...).
+ * Example:
+ * @code
+ *   struct scale_kernel
+ *   {
+ *       template <typename T, typename Layout>
+ *       static void apply(void* data, std::size_t size) { ... }
+ *   };
+ *   using table = tuple_utils::dispatch_table<
+ *       void(void*, std::size_t),
+ *       scale_kernel,
+ *       tuple_utils::type_list<float, double>,
+ *       tuple_utils::type_list<row_major, column_major>
+ *   >;
+ *   table::call({is_double, is_column_major}, data, size); //calls scale_kernel::apply<double, row_major>
+ *                                                          //for is_double = 1 and is_column_major = 0
+ * @endcode
+ * @tparam Signature - type of the kernel functions, R(Args...)
+ * @tparam Kernel - class with static member function template apply
+ * @tparam Lists... - type_lists of policy types, one for each runtime choice
+ */
+template <
+        typename R,
+        typename... Args,
+        typename Kernel,
+        typename... Lists
+        >
+struct dispatch_table<R(Args...), Kernel, Lists...>
+{
+    static_assert(sizeof...(Lists) > 0, "At least one list of policies is required");
+
+    using pointer = R (*)(Args...);
+    using combinations = typename type_list_product<Lists...>::type;
+
+    static constexpr std::size_t size = combinations::size;
+    static_assert(size > 0, "Lists of policies can not be empty");
+
+    /**
+     * @brief Number of policy types in each list, the range of each runtime choice
+     */
+    using extents = index_sequence<Lists::size...>;
+
+    /**
+     * @brief Index of the combination which uses choices[j]-th type of j-th list
+     * @throw std::out_of_range if any choice is not smaller than the size of its list
+     */
+    static constexpr std::size_t index(const std::size_t (&choices)[sizeof...(Lists)])
+    {
+        return details::choices_in_range(details::sequence_array<extents>::value, choices, sizeof...(Lists))
+            ? details::product_position(details::sequence_array<extents>::value, choices, 0, sizeof...(Lists))
+            : throw std::out_of_range("dispatch_table: choice out of range");
+    }
+
+    /**
+     * @brief Pointer to the kernel for the combination with index k, see index()
+     * @throw std::out_of_range if k is not smaller than size
+     */
+    static constexpr pointer at(std::size_t k)
+    {
+        return k < size
+            ? details::kernel_pointers<Kernel, pointer, combinations>::value[k]
+            : throw std::out_of_range("dispatch_table: index out of range");
+    }
+
+    /**
+     * @brief Pointer to the kernel selected by one choice for each list
+     * @throw std::out_of_range if any choice is out of range, see index()
+     */
+    static constexpr pointer find(const std::size_t (&choices)[sizeof...(Lists)])
+    {
+        return at(index(choices));
+    }
+
+    /**
+     * @brief Call the kernel selected by one choice for each list
+     * @throw std::out_of_range if any choice is out of range, no kernel is called then
+     */
+    static R call(const std::size_t (&choices)[sizeof...(Lists)], Args... args)
+    {
+        return find(choices)(std::forward<Args>(args)...);
+    }
+};
+
+template <
+        typename R,
+        typename... Args,
+        typename Kernel,
+        typename... Lists
+        >
+constexpr std::size_t dispatch_table<R(Args...), Kernel, Lists...>::size;
+
+} //namespace tuple_utils
+
+#endif // DISPATCH_TABLE_H
@@ -3,6 +3,7 @@
 
 #include <tuple>
 #include <type_traits>
+#include "aux/get.hpp"
 #include "aux/sequence.hpp"
 #include "aux/traits.hpp"
 
@@ -22,17 +23,18 @@ namespace details
 
 /**
  * @brief Helper function which calls function 'func' for 'tuple' elements
- * Use pack expansion to get each tuple element and forward those values into function 'func'
+ * Use pack expansion to get each tuple element and forward those values into function 'func'.
+ * Elements of lvalue tuples are passed as lvalues and elements of rvalue tuples as rvalues.
  */
 template <
         typename Func,
         typename Tuple,
         std::size_t... Seq
         >
-auto explode_det(Func&& func, Tuple&& tuple, sequence<Seq...>)
--> decltype(func(std::forward<typename std::tuple_element<Seq, Tuple>::type>(std::get<Seq>(tuple))...))
+auto explode_det(Func&& func, Tuple&& tuple, index_sequence<Seq...>)
+-> decltype(std::forward<Func>(func)(tuple_get<Seq>(std::forward<Tuple>(tuple))...))
 {
-    return func(std::forward<typename std::tuple_element<Seq, Tuple>::type>(std::get<Seq>(tuple))...);
+    return std::forward<Func>(func)(tuple_get<Seq>(std::forward<Tuple>(tuple))...);
 }
 
 }//namespace details
@@ -42,7 +44,7 @@ auto explode_det(Func&& func, Tuple&& tuple, sequence<Seq...>)
  * Take function f with argument types X, Y, ..., Z and std::tuple<X, Y, ..., Z> and call f with
  * arguments values extracted from the given tuple.
  * @tparam Func - type of function which will be called for tuple elements
- * @tparam Tuple - std::tuple type passed as an argument
+ * @tparam Tuple - std::tuple (or other tuple-like type, e.g. merged_view) type passed as an argument
  * @return Result of function f called for values from inside argument tuple.
  *
  * Example:
@@ -58,14 +60,14 @@ template <
 auto explode(Func&& func, Tuple&& tuple)
 -> decltype(details::explode_det(
                 std::forward<Func>(func),
-                std::forward<typename std::decay<Tuple>::type>(tuple),
-                typename make_sequence<size_bare<Tuple>::value>::type()
+                std::forward<Tuple>(tuple),
+                make_index_sequence<size_bare<Tuple>::value>()
             ))
 {
     return details::explode_det(
                 std::forward<Func>(func),
-                std::forward<typename std::decay<Tuple>::type>(tuple),
-                typename make_sequence<size_bare<Tuple>::value>::type()
+                std::forward<Tuple>(tuple),
+                make_index_sequence<size_bare<Tuple>::value>()
             );
 }
 
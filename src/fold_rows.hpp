@@ -0,0 +1,300 @@
+#ifndef FOLD_ROWS_H
+#define FOLD_ROWS_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "fold_tuples.hpp"
+#include "soa_vector.hpp"
+#include "aux/get.hpp"
+#include "aux/sequence.hpp"
+#include "aux/traits.hpp"
+
+/**
+ * @file
+ * @author
+ * @version
+*/
+
+//! Utilities for tuples manipulation
+namespace tuple_utils
+{
+
+///@internal
+namespace details
+{
+
+/**
+ * @brief Column I of a container of std::tuples, element i is std::get<I>(rows[i])
+ * Elements are passed with the value category of Rows, so elements of rvalue rows could be moved.
+ * @tparam Rows - type of the container as it was forwarded, lvalue reference or non-reference type
+ */
+template <
+        std::size_t I,
+        typename Rows
+        >
+struct rows_column
+{
+    typename std::remove_reference<Rows>::type& rows;
+
+    auto operator[](std::size_t i) const
+    -> decltype(forward_like<Rows>(std::get<I>(rows[i])))
+    {
+        return forward_like<Rows>(std::get<I>(rows[i]));
+    }
+};
+
+/**
+ * @brief Columns of a container of std::tuples, with the same interface as soa_vector::column
+ */
+template <
+        typename Rows
+        >
+struct rows_columns
+{
+    typename std::remove_reference<Rows>::type& rows;
+
+    std::size_t size() const
+    {
+        return rows.size();
+    }
+
+    template <
+            std::size_t I
+            >
+    rows_column<I, Rows> column() const
+    {
+        return rows_column<I, Rows>{rows};
+    }
+};
+
+/**
+ * @brief Columns of rows given to tuple_utils::fold_rows, rows_columns for containers of std::tuples
+ * @tparam Rows - type of the container as it was forwarded
+ */
+template <
+        typename Rows,
+        typename Bare = typename std::decay<Rows>::type
+        >
+struct fold_rows_source
+{
+    using type = rows_columns<Rows>;
+    static constexpr bool contiguous = false;
+    using indices = make_index_sequence<std::tuple_size<typename Bare::value_type>::value>;
+
+    static type get(typename std::remove_reference<Rows>::type& rows)
+    {
+        return type{rows};
+    }
+};
+
+/**
+ * @brief soa_vector already keeps its columns, they are read directly
+ */
+template <
+        typename Rows,
+        typename... T
+        >
+struct fold_rows_source<Rows, soa_vector<T...>>
+{
+    using type = soa_vector<T...>;
+    static constexpr bool contiguous = true;
+    using indices = index_sequence_for<T...>;
+
+    static const type& get(const type& rows)
+    {
+        return rows;
+    }
+};
+
+/**
+ * @brief Type of I-th element of std::tuple returned by tuple_utils::fold_rows
+ * It is the decayed result of f called for two elements of column I, as for tuple_utils::fold of two rows.
+ * The same type is used for the partial result of the whole column, so f(x, partial) has to be convertible to it.
+ */
+template <
+        std::size_t I,
+        typename FuncType,
+        typename Columns
+        >
+struct fold_rows_element
+{
+    using element = decltype(std::declval<const Columns&>().template column<I>()[0]);
+    using type = typename std::decay<typename call_result<FuncType, element, element>::type>::type;
+};
+
+//Forward declaration
+template <
+        typename Seq,
+        typename FuncType,
+        typename Columns
+        >
+struct fold_rows_result_det;
+
+/**
+ * @brief Determine std::tuple type returned by tuple_utils::fold_rows with fold_rows_element for each column
+ */
+template <
+        std::size_t... I,
+        typename FuncType,
+        typename Columns
+        >
+struct fold_rows_result_det<index_sequence<I...>, FuncType, Columns>
+{
+    using type = std::tuple<typename fold_rows_element<I, FuncType, Columns>::type...>;
+};
+
+/**
+ * @brief The first partial result of a column, from its last two elements or from the only one
+ */
+template <
+        typename Partial,
+        typename FuncType,
+        typename Column
+        >
+Partial fold_rows_last(FuncType& f, const Column& column, std::size_t size)
+{
+    return size == 1 ? Partial(column[0]) : Partial(call_forwarding(f, column[size - 2], column[size - 1]));
+}
+
+/**
+ * @brief Fold the rest of one contiguous column into its partial result, from the last element to the first
+ * The loop reads only one array, so for arithmetic elements and functions such as sums, min or max the
+ * compiler could vectorize it (for floating point sums only when reassociation is allowed, e.g. -ffast-math).
+ */
+template <
+        typename Partial,
+        typename FuncType,
+        typename Column
+        >
+void fold_rows_column(FuncType& f, Partial& partial, const Column& column, std::size_t last)
+{
+    //local partial result could be kept in a register, partial could alias elements of the column
+    Partial local(std::move(partial));
+    for (std::size_t i = last; i-- > 0;)
+    {
+        local = call_forwarding(f, column[i], std::move(local));
+    }
+    partial = std::move(local);
+}
+
+/**
+ * @brief Fold columns of soa_vector, every column in its own loop over a contiguous array
+ */
+template <
+        std::size_t... I,
+        typename Ret,
+        typename FuncType,
+        typename Columns
+        >
+void fold_rows_rest(std::true_type, index_sequence<I...>, Ret& partials, FuncType& f, const Columns& columns,
+                    std::size_t last)
+{
+    expand{(fold_rows_column(f, std::get<I>(partials), columns.template column<I>(), last), 0)...};
+}
+
+/**
+ * @brief Fold rows of a container of std::tuples, all columns of a row at once
+ * Loops over single columns would read elements with a stride of the whole row, such loops are not
+ * vectorized and they read every row as many times as there are columns, so rows are read once instead
+ * and independent columns are folded in parallel by the CPU.
+ */
+template <
+        std::size_t... I,
+        typename Ret,
+        typename FuncType,
+        typename Columns
+        >
+void fold_rows_rest(std::false_type, index_sequence<I...>, Ret& partials, FuncType& f, const Columns& columns,
+                    std::size_t last)
+{
+    Ret local(std::move(partials));
+    for (std::size_t i = last; i-- > 0;)
+    {
+        expand{(std::get<I>(local) = call_forwarding(
+                    f, columns.template column<I>()[i], std::move(std::get<I>(local))
+                ), 0)...};
+    }
+    partials = std::move(local);
+}
+
+/**
+ * @brief Helper function used by tuple_utils::fold_rows
+ * Partial results are created from the last one or two rows, then the rest of rows is folded into them.
+ * @tparam Contiguous - true for soa_vector, which is folded column by column
+ * @param columns - soa_vector or rows_columns
+ */
+template <
+        typename Ret,
+        bool Contiguous,
+        std::size_t... I,
+        typename FuncType,
+        typename Columns
+        >
+Ret fold_rows_det(index_sequence<I...>, FuncType& f, const Columns& columns)
+{
+    const std::size_t size = columns.size();
+    if (size == 0)
+    {
+        throw std::invalid_argument("fold_rows: no rows to fold");
+    }
+    Ret partials(fold_rows_last<typename std::tuple_element<I, Ret>::type>(f, columns.template column<I>(), size)...);
+    if (size > 2)
+    {
+        fold_rows_rest(std::integral_constant<bool, Contiguous>(), index_sequence<I...>(), partials, f, columns,
+                       size - 2);
+    }
+    return partials;
+}
+
+} //namespace details
+///@endinternal
+
+/**
+ * @brief Fold rows of std::vector of std::tuples column by column, as tuple_utils::fold folds few tuples
+ * For rows r0, r1,..., r(N-1) the I-th element of the result is f(r0[I], f(r1[I],... f(r(N-2)[I], r(N-1)[I]))),
+ * the same value as fold(f, r0, r1,..., r(N-1)) gives for a number of rows known at compile time.
+ * The type of I-th element is the decayed type of f called for two elements of column I, partial results
+ * of the column have the same type. Single row gives a copy of itself (converted to the result type).
+ * Columns of soa_vector are contiguous arrays, each of them is folded in its own loop, so for arithmetic
+ * columns the loops could be vectorized. Rows of other containers are read once, all columns of a row at
+ * a time. Elements of rvalue rows are moved into f if f accepts them. As for fold, f is never copied,
+ * all calls are made on the given function object, so its state is kept.
+ * Rows could be given in any container with size() and operator[] (e.g. std::vector or std::deque) or in
+ * soa_vector (its elements are always passed as const lvalues).
+ * @param f - binary function
+ * @param rows - non-empty container of std::tuples or soa_vector
+ * @throw std::invalid_argument if rows are empty
+ *
+ *  Example Usage:
+ *  @code
+ *    std::vector<std::tuple<int, double>> rows {std::make_tuple(1, 0.5), std::make_tuple(2, 1.5)};
+ *    auto sums = tuple_utils::fold_rows(std::plus<>(), rows); //std::plus<>() from C++14
+ *    // sums is equal to std::tuple<int, double>{3, 2.0}
+ * @endcode
+ */
+template <
+        typename FuncType,
+        typename Rows
+        >
+auto fold_rows(FuncType&& f, Rows&& rows)
+-> typename details::fold_rows_result_det<
+        typename details::fold_rows_source<Rows>::indices,
+        FuncType,
+        typename details::fold_rows_source<Rows>::type
+    >::type
+{
+    using source = details::fold_rows_source<Rows>;
+    using ret_type = typename details::fold_rows_result_det<
+        typename source::indices,
+        FuncType,
+        typename source::type
+    >::type;
+    return details::fold_rows_det<ret_type, source::contiguous>(typename source::indices(), f, source::get(rows));
+}
+
+} //namespace tuple_utils
+
+#endif // FOLD_ROWS_H
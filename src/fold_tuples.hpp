@@ -4,7 +4,9 @@
 #include <tuple>
 #include <type_traits>
 #include "make_custom_tuple.hpp"
+#include "aux/get.hpp"
 #include "aux/traits.hpp"
+#include "aux/type_list.hpp"
 
 /**
  * @file
@@ -19,49 +21,111 @@ namespace tuple_utils
 namespace details
 {
 
+/**
+ * @brief Determine type of one element of std::tuple returned by the tuple_utils::fold
+ * Type is determined by the order of folding, the function used for folding and types of arguments
+ * at the index I. Elements of rvalue tuples are rvalues, so they could be moved into the function.
+ */
+template <
+        std::size_t I,
+        typename Order,
+        typename FuncType,
+        typename... Tuples
+        >
+struct fold_element_type
+{
+    using type = typename Order::template result<FuncType, typename tuple_get_type<I, Tuples>::type...>::type;
+};
+
+//Forward declaration
+template <
+        typename Seq,
+        typename Order,
+        typename FuncType,
+        typename... Tuples
+        >
+struct fold_result_type_det;
+
+/**
+ * @brief Determine std::tuple type with fold_element_type for each index from the sequence at once
+ */
+template <
+        std::size_t... I,
+        typename Order,
+        typename FuncType,
+        typename... Tuples
+        >
+struct fold_result_type_det<index_sequence<I...>, Order, FuncType, Tuples...>
+{
+    using type = decltype(std::make_tuple(
+        std::declval<typename fold_element_type<I, Order, FuncType, Tuples...>::type>()...
+    ));
+};
+
 /**
  * @brief Determine type returned by the tuple_utils::fold
  * For each index in std::tuples taken as fold arguments set type in std::tuple type returned by fold.
  * Each type will be determined by the function used for folding and arguments types at given indexes
  * Example: fold(plus<>(), std::make_tuple(1, 2.1), std::make_tuple(3.3, 4)) will return value of type std::tuple<double, double>
- * @tparam Curr - current index which will be used for evaluation
- * @tparam Last - size of std::tuple returned by tuple_utils::fold (equal to the least size of fold arguments)
+ * All indexes are expanded at once, so there is no recursion over the columns.
+ * @tparam Size - size of std::tuple returned by tuple_utils::fold (equal to the least size of fold arguments)
+ * @tparam Order - order of folding, one of fold_right_order, fold_left_order and fold_tree_order
  * @tparam FuncType - function which determines the resoult type
  * @tparam Tuples... - types of tuple_utils::fold arguments
  */
 template <
-        int Curr,
-        int Last,
+        std::size_t Size,
+        typename Order,
         typename FuncType,
         typename... Tuples
         >
-struct fold_result_type
+struct fold_result_type : fold_result_type_det<make_index_sequence<Size>, Order, FuncType, Tuples...>
 {
     static_assert(contain_empty<Tuples...>::value == false, "Can not fold empty tuple");
-    using type = decltype(std::tuple_cat(std::make_tuple(
-        std::declval<typename result_of_rec<
-            FuncType,
-            typename std::tuple_element<Curr, typename std::remove_reference<Tuples>::type>::type...>::type
-        >()),
-        std::declval<typename fold_result_type<Curr + 1, Last, FuncType, typename std::remove_reference<Tuples>::type...>::type>()
-    ));
 };
 
 /**
- * @brief Last recursive step of fold_result_type. Determine type at last postition in std::tuple returned from fold
+ * @brief Call function f with arguments forwarded if f accepts them, see details::call_result
  */
 template <
-        int Last,
         typename FuncType,
-        typename... Tuples
+        typename... Args
         >
-struct fold_result_type<Last, Last, FuncType, Tuples...>
+TUTILS_CONSTEXPR14 auto call_forwarding_det(std::true_type, FuncType& f, Args&&... args)
+-> typename call_result<FuncType, Args...>::type
 {
-    using type = decltype(std::make_tuple(std::declval<typename result_of_rec<
-        FuncType,
-        typename std::tuple_element<Last, typename std::remove_reference<Tuples>::type>::type...>::type
-    >()));
-};
+    return f(std::forward<Args>(args)...);
+}
+
+/**
+ * @brief Call function f with all arguments passed as lvalues, used when f does not accept forwarded arguments
+ */
+template <
+        typename FuncType,
+        typename... Args
+        >
+TUTILS_CONSTEXPR14 auto call_forwarding_det(std::false_type, FuncType& f, Args&&... args)
+-> typename call_result<FuncType, Args...>::type
+{
+    return f(args...);
+}
+
+/**
+ * @brief Call function f with arguments forwarded or passed as lvalues, depending on what f accepts
+ */
+template <
+        typename FuncType,
+        typename... Args
+        >
+TUTILS_CONSTEXPR14 auto call_forwarding(FuncType& f, Args&&... args)
+-> typename call_result<FuncType, Args...>::type
+{
+    return call_forwarding_det(
+                std::integral_constant<bool, call_result<FuncType, Args...>::forward>(),
+                f,
+                std::forward<Args>(args)...
+            );
+}
 
 //Forward declaration
 template <
@@ -69,7 +133,7 @@ template <
         typename Y,
         typename Z
         >
-auto invoke_helper(FuncType f, Y& beforelast, Z& last)
+TUTILS_CONSTEXPR14 auto invoke_helper(FuncType& f, Y&& beforelast, Z&& last)
 -> typename result_of_rec<FuncType, Y, Z>::type;
 
 /**
@@ -83,12 +147,13 @@ template <
         typename F,
         typename... R
         >
-auto invoke_helper(FuncType f, F& first, R&... rest)
+TUTILS_CONSTEXPR14 auto invoke_helper(FuncType& f, F&& first, R&&... rest)
 -> typename result_of_rec<FuncType, F, R...>::type
 {
-    //without indirect x variable fold could not accept functions taking second argument by reference
-    auto x = invoke_helper<FuncType, R...>(f, rest...);
-    return f(first, x);
+    //without indirect x variable fold could not accept functions taking second argument by reference,
+    //x is moved into f if f accepts rvalue
+    auto x = invoke_helper<FuncType, R...>(f, std::forward<R>(rest)...);
+    return call_forwarding(f, std::forward<F>(first), std::move(x));
 }
 
 /**
@@ -100,10 +165,10 @@ template <
         typename Y,
         typename Z
         >
-auto invoke_helper(FuncType f, Y& beforelast, Z& last)
+TUTILS_CONSTEXPR14 auto invoke_helper(FuncType& f, Y&& beforelast, Z&& last)
 -> typename result_of_rec<FuncType, Y, Z>::type
 {
-    return f(beforelast, last);
+    return call_forwarding(f, std::forward<Y>(beforelast), std::forward<Z>(last));
 }
 
 /**
@@ -114,66 +179,585 @@ template <
         typename FuncType,
         typename Y
         >
-auto invoke_helper(FuncType f, Y& onlyOne)
+TUTILS_CONSTEXPR14 auto invoke_helper(FuncType& f, Y&& onlyOne)
 -> typename result_of_rec<FuncType, Y>::type
 {
-    return f(onlyOne);
+    return call_forwarding(f, std::forward<Y>(onlyOne));
+}
+
+/**
+ * @brief Last step of invoke_left, the result of binary function f invoked for the last two arguments
+ */
+template <
+        typename FuncType,
+        typename X,
+        typename Y
+        >
+TUTILS_CONSTEXPR14 auto invoke_left(FuncType& f, X&& x, Y&& y)
+-> typename result_of_left<FuncType, X, Y>::type
+{
+    return call_forwarding(f, std::forward<X>(x), std::forward<Y>(y));
 }
 
 /**
- * @brief Helper function used by the tuple_utils::fold
- * Assigns values in unrolled loop based on current index, used recursively
- * @tparam Begin - starting index, should be 0
- * @tparam End - value of the std::tuple_size<X>::value, ends loop unrolling
+ * @brief Special case when fold_left is invoked with unary function
  */
 template <
-        int Begin,
-        int End
+        typename FuncType,
+        typename X
         >
-struct tuple_fold_det
+TUTILS_CONSTEXPR14 auto invoke_left(FuncType& f, X&& onlyOne)
+-> typename result_of_left<FuncType, X>::type
 {
-    /**
-     * Each call assigns folded values of tuple elements given at the index Begin to the resulting tuple.
-     * Then increment index value and recursively call fold_helper
-     */
+    return call_forwarding(f, std::forward<X>(onlyOne));
+}
+
+/**
+ * @brief Fold arguments from the left, for x1, x2, x3,..., xN return f(f(f(x1, x2), x3),... xN)
+ * The partial result is passed on as an rvalue, so it is moved into f if f accepts rvalues.
+ */
+template <
+        typename FuncType,
+        typename X,
+        typename Y,
+        typename Z,
+        typename... R
+        >
+TUTILS_CONSTEXPR14 auto invoke_left(FuncType& f, X&& x, Y&& y, Z&& z, R&&... rest)
+-> typename result_of_left<FuncType, X, Y, Z, R...>::type
+{
+    using partial = typename std::decay<typename call_result<FuncType, X, Y>::type>::type;
+    return invoke_left(
+                f,
+                partial(call_forwarding(f, std::forward<X>(x), std::forward<Y>(y))),
+                std::forward<Z>(z),
+                std::forward<R>(rest)...
+            );
+}
+
+//Forward declaration
+template <
+        std::size_t Begin,
+        std::size_t End,
+        typename FuncType,
+        typename... Args
+        >
+TUTILS_CONSTEXPR14 auto invoke_tree(FuncType& f, const std::tuple<Args&&...>& args)
+-> typename tree_call_result<FuncType, type_list<Args...>, Begin, End>::type;
+
+/**
+ * @brief Operand of tree fold made of a single argument, it is forwarded as it is
+ */
+template <
+        std::size_t Begin,
+        std::size_t End,
+        typename FuncType,
+        typename... Args
+        >
+TUTILS_CONSTEXPR14 auto tree_operand_value(std::true_type, FuncType&, const std::tuple<Args&&...>& args)
+-> typename type_at<Begin, type_list<Args...>>::type&&
+{
+    return std::forward<typename type_at<Begin, type_list<Args...>>::type>(std::get<Begin>(args));
+}
+
+/**
+ * @brief Operand of tree fold made of more arguments, the result of folding them passed as an rvalue
+ */
+template <
+        std::size_t Begin,
+        std::size_t End,
+        typename FuncType,
+        typename... Args
+        >
+TUTILS_CONSTEXPR14 auto tree_operand_value(std::false_type, FuncType& f, const std::tuple<Args&&...>& args)
+-> typename tree_operand<FuncType, type_list<Args...>, Begin, End>::type
+{
+    using operand = typename tree_operand<FuncType, type_list<Args...>, Begin, End>::type;
+    return operand(invoke_tree<Begin, End, FuncType, Args...>(f, args));
+}
+
+/**
+ * @brief Fold arguments in range [Begin, End) as a balanced tree, f(fold of left half, fold of right half)
+ * Both halves do not depend on each other, so the depth of dependent calls is logarithmic.
+ * @param args - std::tuple of references to all arguments (from std::forward_as_tuple)
+ */
+template <
+        std::size_t Begin,
+        std::size_t End,
+        typename FuncType,
+        typename... Args
+        >
+TUTILS_CONSTEXPR14 auto invoke_tree(FuncType& f, const std::tuple<Args&&...>& args)
+-> typename tree_call_result<FuncType, type_list<Args...>, Begin, End>::type
+{
+    constexpr std::size_t middle = tree_call_result<FuncType, type_list<Args...>, Begin, End>::middle;
+    return call_forwarding(
+                f,
+                tree_operand_value<Begin, middle, FuncType, Args...>(
+                    std::integral_constant<bool, middle - Begin == 1>(), f, args
+                ),
+                tree_operand_value<middle, End, FuncType, Args...>(
+                    std::integral_constant<bool, End - middle == 1>(), f, args
+                )
+            );
+}
+
+/**
+ * @brief Fold in order f(x1, f(x2, f(x3,... xN))), used by tuple_utils::fold
+ */
+struct fold_right_order
+{
+    template <
+            typename FuncType,
+            typename... Args
+            >
+    using result = result_of_rec<FuncType, Args...>;
+
     template <
             typename FuncType,
-            typename Result,
-            typename... T
+            typename... Args
             >
-    static void fold_helper(const FuncType& f, Result&& result, T&&... tuples)
+    static TUTILS_CONSTEXPR14 typename result_of_rec<FuncType, Args...>::type invoke(FuncType& f, Args&&... args)
     {
-        tuple_utils::details::assign(std::get<Begin>(result), invoke_helper(f, std::get<Begin>(tuples)...));
-        tuple_fold_det<Begin + 1, End>::fold_helper(
-                    f,
-                    std::forward<Result>(result),
-                    std::forward<T>(tuples)...
-        );
-     }
+        return invoke_helper<FuncType>(f, std::forward<Args>(args)...);
+    }
 };
 
 /**
- * @brief Last call of unrolled tuple_fold_det struct
- * Partial template specialization used to call fold_helper for the one past last tuple element.
+ * @brief Fold in order f(f(f(x1, x2), x3),... xN), used by tuple_utils::fold_left
  */
-template <
-        int End
-        >
-struct tuple_fold_det<End, End>
+struct fold_left_order
 {
+    template <
+            typename FuncType,
+            typename... Args
+            >
+    using result = result_of_left<FuncType, Args...>;
+
+    template <
+            typename FuncType,
+            typename... Args
+            >
+    static TUTILS_CONSTEXPR14 typename result_of_left<FuncType, Args...>::type invoke(FuncType& f, Args&&... args)
+    {
+        return invoke_left(f, std::forward<Args>(args)...);
+    }
+};
+
+/**
+ * @brief Fold as a balanced tree, e.g. f(f(x1, x2), f(x3, x4)), used by tuple_utils::fold_tree
+ */
+struct fold_tree_order
+{
+    template <
+            typename FuncType,
+            typename... Args
+            >
+    using result = result_of_tree<FuncType, Args...>;
+
     /**
-     * @brief Called for the std::tuple_size<X>::value index, which is one past last tuple element,
-     * thus in this case fold_helper is no-op
+     * @brief Unary function is simply called for the only argument
      */
     template <
             typename FuncType,
-            typename Res,
-            typename... T
+            typename X
             >
-    static void fold_helper(const FuncType&, Res&&, T&&...)
-    { }
+    static TUTILS_CONSTEXPR14 typename result_of_tree<FuncType, X>::type invoke(FuncType& f, X&& onlyOne)
+    {
+        return call_forwarding(f, std::forward<X>(onlyOne));
+    }
+
+    template <
+            typename FuncType,
+            typename X,
+            typename Y,
+            typename... Args
+            >
+    static TUTILS_CONSTEXPR14 typename result_of_tree<FuncType, X, Y, Args...>::type
+    invoke(FuncType& f, X&& x, Y&& y, Args&&... args)
+    {
+        return invoke_tree<0, sizeof...(Args) + 2, FuncType, X, Y, Args...>(
+                    f,
+                    std::tuple<X&&, Y&&, Args&&...>(std::forward<X>(x), std::forward<Y>(y), std::forward<Args>(args)...)
+                );
+    }
+};
+
+/**
+ * @brief Fold elements at index I of all tuples, references to the tuples are kept in refs
+ * @tparam T... - indices of tuples in refs, sequence 0, 1,..., sizeof...(Tuples)-1
+ * @tparam Tuples... - lvalue or rvalue references to the folded tuples
+ */
+template <
+        std::size_t I,
+        typename Order,
+        std::size_t... T,
+        typename FuncType,
+        typename... Tuples
+        >
+auto fold_column(index_sequence<T...>, FuncType& f, const std::tuple<Tuples...>& refs)
+-> typename fold_element_type<I, Order, FuncType, Tuples...>::type
+{
+    return Order::invoke(f, tuple_get<I>(std::forward<Tuples>(std::get<T>(refs)))...);
+}
+
+/**
+ * @brief Helper function used by the tuple_utils::fold, creates the resulting std::tuple at once
+ * Each element is constructed directly from the folded values, so no element is default constructed
+ * nor assigned. Each column reads different elements, so elements of rvalue tuples are moved at most once.
+ * @tparam Ret - type of the std::tuple returned by tuple_utils::fold
+ * @tparam Order - order of folding of each column
+ * @tparam I... - sequence 0, 1,..., N-1 where N is the size of the resulting std::tuple
+ */
+template <
+        typename Ret,
+        typename Order,
+        std::size_t... I,
+        typename FuncType,
+        typename... Tuples
+        >
+Ret fold_det(index_sequence<I...>, FuncType& f, const std::tuple<Tuples...>& refs)
+{
+    return Ret(fold_column<I, Order>(index_sequence_for<Tuples...>(), f, refs)...);
+}
+
+/**
+ * @brief Type of one element of std::tuple returned by tuple_utils::fold_accumulate, type of the accumulator
+ */
+template <
+        std::size_t I,
+        typename First
+        >
+struct accumulator_type
+{
+    using type = typename std::decay<typename tuple_get_type<I, First>::type>::type;
+};
+
+//Forward declaration
+template <
+        typename Seq,
+        typename First
+        >
+struct accumulate_result_type_det;
+
+/**
+ * @brief Determine std::tuple type returned by tuple_utils::fold_accumulate, one accumulator for each index
+ */
+template <
+        std::size_t... I,
+        typename First
+        >
+struct accumulate_result_type_det<index_sequence<I...>, First>
+{
+    using type = std::tuple<typename accumulator_type<I, First>::type...>;
+};
+
+/**
+ * @brief Accumulate elements at index I of all arguments in one accumulator
+ * Accumulator is initialized with the element of the first argument (moved from rvalue tuple), then
+ * op(acc, x) is called for elements of the rest of arguments in order. The accumulator is returned,
+ * so it is moved (or constructed in place) into the result.
+ */
+template <
+        std::size_t I,
+        typename FuncType,
+        typename First,
+        typename... Rest
+        >
+typename accumulator_type<I, First>::type accumulate_values(FuncType& op, First&& first, Rest&&... rest)
+{
+    typename accumulator_type<I, First>::type acc(tuple_get<I>(std::forward<First>(first)));
+    expand{(call_forwarding(op, acc, tuple_get<I>(std::forward<Rest>(rest))), 0)...};
+    return acc;
+}
+
+/**
+ * @brief Accumulate column I of tuples kept in refs, all columns are accumulated with the same op
+ */
+template <
+        std::size_t I,
+        std::size_t... T,
+        typename FuncType,
+        typename... Tuples
+        >
+typename accumulator_type<I, typename type_at<0, type_list<Tuples...>>::type>::type
+accumulate_column(index_sequence<T...>, FuncType& op, const std::tuple<Tuples...>& refs)
+{
+    return accumulate_values<I>(op, std::forward<Tuples>(std::get<T>(refs))...);
+}
+
+/**
+ * @brief Helper function used by tuple_utils::fold_accumulate, creates the resulting std::tuple at once
+ */
+template <
+        typename Ret,
+        std::size_t... I,
+        typename FuncType,
+        typename... Tuples
+        >
+Ret accumulate_det(index_sequence<I...>, FuncType& op, const std::tuple<Tuples...>& refs)
+{
+    return Ret(accumulate_column<I>(index_sequence_for<Tuples...>(), op, refs)...);
+}
+
+//Forward declaration
+template <
+        typename FuncType,
+        typename Before,
+        typename Last,
+        typename... Args
+        >
+struct scan_partials;
+
+/**
+ * @brief Determine types of partial results of a scan, each one is the result of f(previous, next operand)
+ * The previous partial result is passed as a const lvalue, because it is kept in the result of the scan.
+ * @tparam Before - type_list of types of all partial results but the last one
+ * @tparam Last - type of the last partial result
+ * @tparam Args... - types of the remaining operands
+ */
+template <
+        typename FuncType,
+        typename... P,
+        typename Last,
+        typename X,
+        typename... R
+        >
+struct scan_partials<FuncType, type_list<P...>, Last, X, R...> :
+        scan_partials<
+            FuncType,
+            type_list<P..., Last>,
+            typename std::decay<typename call_result<FuncType, const Last&, X>::type>::type,
+            R...
+        >
+{ };
+
+/**
+ * @brief All operands are used, type set to std::tuple of all partial results
+ */
+template <
+        typename FuncType,
+        typename... P,
+        typename Last
+        >
+struct scan_partials<FuncType, type_list<P...>, Last>
+{
+    using type = std::tuple<P..., Last>;
+};
+
+//Forward declaration
+template <
+        typename Seq,
+        typename FuncType,
+        typename First,
+        std::size_t Offset,
+        typename Tuple
+        >
+struct scan_result_det;
+
+/**
+ * @brief Partial results starting with First, followed by results for elements Offset, Offset + 1,... of Tuple
+ */
+template <
+        std::size_t... I,
+        typename FuncType,
+        typename First,
+        std::size_t Offset,
+        typename Tuple
+        >
+struct scan_result_det<index_sequence<I...>, FuncType, First, Offset, Tuple> :
+        scan_partials<FuncType, type_list<>, First, typename tuple_get_type<Offset + I, Tuple>::type...>
+{ };
+
+/**
+ * @brief Determine std::tuple type returned by tuple_utils::inclusive_scan and tuple_utils::exclusive_scan
+ * The result has as many elements as Tuple.
+ * @tparam First - metafunction giving the type of the first partial result, evaluated only for non-empty Tuple
+ * @tparam Offset - index of the first element of Tuple which is folded with the first partial result
+ */
+template <
+        typename FuncType,
+        typename First,
+        std::size_t Offset,
+        typename Tuple,
+        bool Empty = size_bare<Tuple>::value == 0
+        >
+struct scan_result_type :
+        scan_result_det<make_index_sequence<size_bare<Tuple>::value - 1>, FuncType, typename First::type, Offset, Tuple>
+{ };
+
+/**
+ * @brief Scan of an empty tuple is an empty tuple
+ */
+template <
+        typename FuncType,
+        typename First,
+        std::size_t Offset,
+        typename Tuple
+        >
+struct scan_result_type<FuncType, First, Offset, Tuple, true>
+{
+    using type = std::tuple<>;
+};
+
+/**
+ * @brief The first partial result of inclusive scan without initial value, copy of the first element
+ */
+template <
+        typename FuncType,
+        typename Tuple,
+        typename... Init
+        >
+struct inclusive_scan_first
+{
+    using type = typename std::decay<typename tuple_get_type<0, Tuple>::type>::type;
+};
+
+/**
+ * @brief The first partial result of inclusive scan with initial value, f(init, first element)
+ */
+template <
+        typename FuncType,
+        typename Tuple,
+        typename Init
+        >
+struct inclusive_scan_first<FuncType, Tuple, Init>
+{
+    using type = typename std::decay<
+        typename call_result<FuncType, Init, typename tuple_get_type<0, Tuple>::type>::type
+    >::type;
 };
 
+/**
+ * @brief All partial results are computed, the resulting std::tuple is created at once
+ * Partial results are temporaries created by the previous steps, so each of them is moved only once.
+ */
+template <
+        std::size_t I,
+        typename Ret,
+        typename FuncType,
+        typename Tuple,
+        typename Last,
+        typename... Before
+        >
+TUTILS_CONSTEXPR14 Ret scan_step(std::true_type, FuncType&, Tuple&&, Last&& last, Before&&... before)
+{
+    return Ret(std::forward<Before>(before)..., std::forward<Last>(last));
+}
+
+/**
+ * @brief Compute the next partial result, f(last, I-th element), and pass all partial results to the next step
+ * @param last - the last partial result, passed to f as a const lvalue
+ * @param before - all previous partial results, in order
+ */
+template <
+        std::size_t I,
+        typename Ret,
+        typename FuncType,
+        typename Tuple,
+        typename Last,
+        typename... Before
+        >
+TUTILS_CONSTEXPR14 Ret scan_step(std::false_type, FuncType& f, Tuple&& tuple, Last&& last, Before&&... before)
+{
+    using next = typename std::tuple_element<sizeof...(Before) + 1, Ret>::type;
+    return scan_step<I + 1, Ret>(
+                std::integral_constant<bool, sizeof...(Before) + 2 == std::tuple_size<Ret>::value>(),
+                f,
+                std::forward<Tuple>(tuple),
+                next(call_forwarding(f, static_cast<const Last&>(last), tuple_get<I>(std::forward<Tuple>(tuple)))),
+                std::forward<Before>(before)...,
+                std::forward<Last>(last)
+            );
+}
+
+/**
+ * @brief Scan of an empty tuple, with or without initial value
+ */
+template <
+        typename Ret,
+        typename FuncType,
+        typename Tuple,
+        typename... Init
+        >
+TUTILS_CONSTEXPR14 Ret inclusive_scan_det(std::true_type, FuncType&, Tuple&&, Init&&...)
+{
+    return Ret();
+}
+
+/**
+ * @brief Inclusive scan without initial value, the first partial result is a copy of the first element
+ */
+template <
+        typename Ret,
+        typename FuncType,
+        typename Tuple
+        >
+TUTILS_CONSTEXPR14 Ret inclusive_scan_det(std::false_type, FuncType& f, Tuple&& tuple)
+{
+    using first = typename std::tuple_element<0, Ret>::type;
+    return scan_step<1, Ret>(
+                std::integral_constant<bool, std::tuple_size<Ret>::value == 1>(),
+                f,
+                std::forward<Tuple>(tuple),
+                first(tuple_get<0>(std::forward<Tuple>(tuple)))
+            );
+}
+
+/**
+ * @brief Inclusive scan with initial value, the first partial result is f(init, first element)
+ */
+template <
+        typename Ret,
+        typename FuncType,
+        typename Tuple,
+        typename Init
+        >
+TUTILS_CONSTEXPR14 Ret inclusive_scan_det(std::false_type, FuncType& f, Tuple&& tuple, Init&& init)
+{
+    using first = typename std::tuple_element<0, Ret>::type;
+    return scan_step<1, Ret>(
+                std::integral_constant<bool, std::tuple_size<Ret>::value == 1>(),
+                f,
+                std::forward<Tuple>(tuple),
+                first(call_forwarding(f, std::forward<Init>(init), tuple_get<0>(std::forward<Tuple>(tuple))))
+            );
+}
+
+/**
+ * @brief Exclusive scan of non-empty tuple, the first partial result is a copy of init
+ */
+template <
+        typename Ret,
+        typename FuncType,
+        typename Tuple,
+        typename Init
+        >
+TUTILS_CONSTEXPR14 Ret exclusive_scan_det(std::false_type, FuncType& f, Tuple&& tuple, Init&& init)
+{
+    using first = typename std::tuple_element<0, Ret>::type;
+    return scan_step<0, Ret>(
+                std::integral_constant<bool, std::tuple_size<Ret>::value == 1>(),
+                f,
+                std::forward<Tuple>(tuple),
+                first(std::forward<Init>(init))
+            );
+}
+
+/**
+ * @brief Exclusive scan of an empty tuple
+ */
+template <
+        typename Ret,
+        typename FuncType,
+        typename Tuple,
+        typename Init
+        >
+TUTILS_CONSTEXPR14 Ret exclusive_scan_det(std::true_type, FuncType&, Tuple&&, Init&&)
+{
+    return Ret();
+}
+
 } //namespace details
 ///@endinternal
 
@@ -183,10 +767,11 @@ struct tuple_fold_det<End, End>
  * for each element from from std::tuples given as an arguments at each index
  * @tparam FuncType - type of function used for folding
  * @tparam Res... - unknown number of std::tuples types given as arguments
- * @param f - binary or unary function which will be used to fold one or more tuples
+ * @param f - binary or unary function which will be used to fold one or more tuples, it is never copied,
+ * all columns are folded with the object given, so state kept by f is preserved
  * @param rest - unknown number of std::tuples
  * @return std::tuple in which each position is equal to the result of folding values from the same positions from
- * the tuples given as arguments
+ * the tuples given as arguments. Elements of rvalue tuples are moved into f when f accepts rvalues.
  *
  *  Example Usage:
  *  @code
@@ -200,14 +785,170 @@ template <
         typename FuncType,
         typename... Tuples
         >
-auto fold(const FuncType& f, Tuples&&... args)
--> typename details::fold_result_type<0, tsize_min<Tuples...>::value - 1, FuncType, Tuples...>::type
+auto fold(FuncType&& f, Tuples&&... args)
+-> typename details::fold_result_type<tsize_min<Tuples...>::value, details::fold_right_order, FuncType, Tuples...>::type
+{
+    constexpr static auto range = tsize_min<Tuples...>::value;
+    using ret_type = typename details::fold_result_type<range, details::fold_right_order, FuncType, Tuples...>::type;
+    return details::fold_det<ret_type, details::fold_right_order>(
+                make_index_sequence<range>(),
+                f,
+                std::tuple<Tuples&&...>(std::forward<Tuples>(args)...)
+            );
+}
+
+/**
+ * @brief Fold few tuples into one as tuple_utils::fold, but each column is folded from the left
+ * For tuples x, y,..., z each element of the result is equal to f(f(f(x[I], y[I]),...), z[I]). The
+ * result type is given by tuple_utils::result_of_left, so it could differ from the one of fold when f is
+ * not symmetric in its argument types. Partial results are moved into f when f accepts rvalues.
+ *
+ *  Example Usage:
+ *  @code
+ *    auto result = tuple_utils::fold_left(std::minus<int>(), std::make_tuple(10), std::make_tuple(3), std::make_tuple(2));
+ *    // result is equal to std::tuple<int>{5}, (10 - 3) - 2, fold would give 10 - (3 - 2)
+ * @endcode
+ */
+template <
+        typename FuncType,
+        typename... Tuples
+        >
+auto fold_left(FuncType&& f, Tuples&&... args)
+-> typename details::fold_result_type<tsize_min<Tuples...>::value, details::fold_left_order, FuncType, Tuples...>::type
 {
     constexpr static auto range = tsize_min<Tuples...>::value;
-    using ret_type = typename details::fold_result_type<0, range - 1, FuncType, Tuples...>::type;
-    ret_type result;
-    details::tuple_fold_det<0, range>::fold_helper(f, std::move(result), std::forward<Tuples>(args)...);
-    return result;
+    using ret_type = typename details::fold_result_type<range, details::fold_left_order, FuncType, Tuples...>::type;
+    return details::fold_det<ret_type, details::fold_left_order>(
+                make_index_sequence<range>(),
+                f,
+                std::tuple<Tuples&&...>(std::forward<Tuples>(args)...)
+            );
+}
+
+/**
+ * @brief Fold few tuples into one as tuple_utils::fold, but each column is folded as a balanced tree
+ * Tuples are split in halves, each half is folded independently and both results are combined with f,
+ * e.g. f(f(x[I], y[I]), f(z[I], w[I])) for four tuples. Chain of dependent calls has logarithmic length
+ * instead of linear, so the CPU could overlap independent calls. Intended for associative functions
+ * (sums, min/max, hash combining), for them the result is equal to the result of fold. The result type
+ * is given by tuple_utils::result_of_tree.
+ */
+template <
+        typename FuncType,
+        typename... Tuples
+        >
+auto fold_tree(FuncType&& f, Tuples&&... args)
+-> typename details::fold_result_type<tsize_min<Tuples...>::value, details::fold_tree_order, FuncType, Tuples...>::type
+{
+    constexpr static auto range = tsize_min<Tuples...>::value;
+    using ret_type = typename details::fold_result_type<range, details::fold_tree_order, FuncType, Tuples...>::type;
+    return details::fold_det<ret_type, details::fold_tree_order>(
+                make_index_sequence<range>(),
+                f,
+                std::tuple<Tuples&&...>(std::forward<Tuples>(args)...)
+            );
+}
+
+/**
+ * @brief Fold few tuples into one with an accumulating function op(acc&, x) which modifies acc in place
+ * For each index one accumulator is created from the element of the first tuple, then op is called for it
+ * and the element of each next tuple, in order. No partial result is created, so e.g. strings or vectors
+ * are appended to one object instead of being copied at each step, as with acc += x. Result is constructed
+ * directly from the accumulators, so its elements do not have to be default constructible. Elements of
+ * rvalue tuples are moved: elements of the first one into the accumulators, others into op if it accepts them.
+ * @param op - function called as op(acc, x), its return value is ignored
+ * @return std::tuple with accumulators, the type of I-th accumulator is the decayed type of I-th element
+ * of the first tuple
+ *
+ *  Example Usage:
+ *  @code
+ *    auto append = [](std::string& acc, const std::string& x) { acc += x; };
+ *    auto result = tuple_utils::fold_accumulate(append, std::make_tuple(std::string("a"), std::string("b")),
+ *                                               std::make_tuple(std::string("c"), std::string("d")));
+ *    // result is equal to std::tuple<std::string, std::string>{"ac", "bd"}
+ * @endcode
+ */
+template <
+        typename FuncType,
+        typename First,
+        typename... Rest
+        >
+auto fold_accumulate(FuncType&& op, First&& first, Rest&&... rest)
+-> typename details::accumulate_result_type_det<make_index_sequence<tsize_min<First, Rest...>::value>, First>::type
+{
+    constexpr static auto range = tsize_min<First, Rest...>::value;
+    using ret_type = typename details::accumulate_result_type_det<make_index_sequence<range>, First>::type;
+    return details::accumulate_det<ret_type>(
+                make_index_sequence<range>(),
+                op,
+                std::tuple<First&&, Rest&&...>(std::forward<First>(first), std::forward<Rest>(rest)...)
+            );
+}
+
+/**
+ * @brief Partial results of folding elements of one tuple from the left, x0, f(x0, x1), f(f(x0, x1), x2),...
+ * With initial value the partial results are f(init, x0), f(f(init, x0), x1),... The result has as many
+ * elements as the tuple, types of elements could differ (e.g. int, long, double for int, long and double
+ * elements summed). Each partial result is computed once, passed to f as a const lvalue (it is kept in the
+ * result) and moved into the result once. Elements of rvalue tuples are moved into f if f accepts rvalues.
+ * The scan is fully unrolled and, when compiled as C++14 or later, it could be evaluated at compile time
+ * if f is constexpr.
+ * @param f - binary function
+ * @param tuple - std::tuple, std::pair, std::array or any other tuple-like type
+ * @param init - at most one initial value
+ *
+ *  Example Usage:
+ *  @code
+ *    auto sums = tuple_utils::inclusive_scan(std::plus<>(), std::make_tuple(1, 2L, 0.5)); //std::plus<>() from C++14
+ *    // sums is equal to std::tuple<int, long, double>{1, 3L, 3.5}
+ * @endcode
+ */
+template <
+        typename FuncType,
+        typename Tuple,
+        typename... Init
+        >
+TUTILS_CONSTEXPR14 auto inclusive_scan(FuncType&& f, Tuple&& tuple, Init&&... init)
+-> typename details::scan_result_type<FuncType, details::inclusive_scan_first<FuncType, Tuple, Init...>, 1, Tuple>::type
+{
+    static_assert(sizeof...(Init) < 2, "Only one initial value could be given");
+    using ret_type =
+        typename details::scan_result_type<FuncType, details::inclusive_scan_first<FuncType, Tuple, Init...>, 1, Tuple>::type;
+    return details::inclusive_scan_det<ret_type>(
+                std::integral_constant<bool, size_bare<Tuple>::value == 0>(),
+                f,
+                std::forward<Tuple>(tuple),
+                std::forward<Init>(init)...
+            );
+}
+
+/**
+ * @brief Partial results of folding elements of one tuple from the left, excluding the current element
+ * For elements x0, x1,..., xN the result is init, f(init, x0), f(f(init, x0), x1),... without the fold
+ * of all elements, so it has as many elements as the tuple. Typical use are offsets computed from sizes.
+ * Partial results are handled as in tuple_utils::inclusive_scan.
+ *
+ *  Example Usage:
+ *  @code
+ *    constexpr auto offsets = tuple_utils::exclusive_scan(std::plus<>(), std::make_tuple(4, 8, 2), 0); //C++14
+ *    // offsets is equal to std::tuple<int, int, int>{0, 4, 12}
+ * @endcode
+ */
+template <
+        typename FuncType,
+        typename Tuple,
+        typename Init
+        >
+TUTILS_CONSTEXPR14 auto exclusive_scan(FuncType&& f, Tuple&& tuple, Init&& init)
+-> typename details::scan_result_type<FuncType, std::decay<Init>, 0, Tuple>::type
+{
+    using ret_type = typename details::scan_result_type<FuncType, std::decay<Init>, 0, Tuple>::type;
+    return details::exclusive_scan_det<ret_type>(
+                std::integral_constant<bool, size_bare<Tuple>::value == 0>(),
+                f,
+                std::forward<Tuple>(tuple),
+                std::forward<Init>(init)
+            );
 }
 
 } //namespace tuple_utils
@@ -0,0 +1,672 @@
+#ifndef INDEX_VIEW_H
+#define INDEX_VIEW_H
+
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "aux/get.hpp"
+#include "aux/sequence.hpp"
+#include "aux/sequence_algebra.hpp"
+#include "aux/traits.hpp"
+#include "aux/type_list.hpp"
+#include "merged_view.hpp"
+
+/**
+ * @file
+ * @author
+ * @version
+*/
+
+//! Utilities for tuples manipulation
+namespace tuple_utils
+{
+
+//forward declaration
+template <typename Map, typename... Tuples>
+struct index_view;
+
+///@internal
+namespace details
+{
+
+/**
+ * @brief Add N to every value of index_sequence, used to move an index map past the elements of other tuples
+ */
+template <
+        std::size_t N,
+        typename Seq
+        >
+struct sequence_offset;
+
+template <
+        std::size_t N,
+        std::size_t... I
+        >
+struct sequence_offset<N, index_sequence<I...>>
+{
+    using type = index_sequence<(N + I)...>;
+};
+
+/**
+ * @brief Create index_view type with index map Map over tuples from type_list
+ */
+template <
+        typename Map,
+        typename Tuples
+        >
+struct index_view_type;
+
+template <
+        typename Map,
+        typename... Tuples
+        >
+struct index_view_type<Map, type_list<Tuples...>>
+{
+    using type = index_view<Map, Tuples...>;
+};
+
+/**
+ * @brief Rvalue tuple kept by index_view, moved once into its own allocation
+ * Views created from an rvalue view take the box over, so elements of rvalue tuples are moved only into
+ * the box and out of it however many view operations are applied. Copying the box copies the tuple.
+ */
+template <
+        typename Tuple
+        >
+class kept_box
+{
+public:
+    kept_box(Tuple&& tuple)
+        : ptr(new Tuple(std::move(tuple)))
+    { }
+
+    kept_box(const kept_box& other)
+        : ptr(new Tuple(*other.ptr))
+    { }
+
+    kept_box(kept_box&& other) noexcept
+        : ptr(std::move(other.ptr))
+    { }
+
+    kept_box& operator=(const kept_box&) = delete;
+
+    Tuple& get()
+    {
+        return *ptr;
+    }
+
+    const Tuple& get() const
+    {
+        return *ptr;
+    }
+
+private:
+    std::unique_ptr<Tuple> ptr;
+};
+
+/**
+ * @brief How index_view stores a viewed tuple, lvalue tuples by reference and rvalue tuples in kept_box
+ */
+template <
+        typename Tuple
+        >
+struct kept_storage
+{
+    using type = kept_box<Tuple>;
+};
+
+template <
+        typename Tuple
+        >
+struct kept_storage<Tuple&>
+{
+    using type = Tuple&;
+};
+
+/**
+ * @brief Viewed tuple from its storage in index_view, tuple kept by reference is returned as it is
+ */
+template <
+        typename Tuple
+        >
+Tuple& kept_get(Tuple& tuple)
+{
+    return tuple;
+}
+
+/**
+ * @brief Tuple kept in kept_box, with the value category and constness of the box
+ */
+template <
+        typename Tuple
+        >
+Tuple& kept_get(kept_box<Tuple>& box)
+{
+    return box.get();
+}
+
+template <
+        typename Tuple
+        >
+const Tuple& kept_get(const kept_box<Tuple>& box)
+{
+    return box.get();
+}
+
+template <
+        typename Tuple
+        >
+Tuple&& kept_get(kept_box<Tuple>&& box)
+{
+    return std::move(box.get());
+}
+
+/**
+ * @brief Describe argument of view operations which is not an index_view, i.e. a tuple
+ * Tuple is viewed by itself with the identity map, lvalues are kept as lvalue references and rvalues
+ * are moved into the view, as by make_index_view.
+ */
+template <
+        typename Tuple,
+        typename = typename std::decay<Tuple>::type
+        >
+struct view_traits
+{
+    using map = make_index_sequence<size_bare<Tuple>::value>;
+    using tuples = type_list<Tuple>;
+
+    static std::tuple<Tuple&&> refs(Tuple&& tuple)
+    {
+        return std::tuple<Tuple&&>(std::forward<Tuple>(tuple));
+    }
+};
+
+/**
+ * @brief Type of a tuple kept by index_view of type View, when the view is an argument of view operations
+ * Tuples kept by an rvalue view are taken over as they are kept, tuples kept by value are moved.
+ */
+template <
+        typename Tuple,
+        typename View
+        >
+struct kept_tuple
+{
+    using type = Tuple;
+};
+
+/**
+ * @brief Lvalue view lends its tuples, tuples kept by value are referenced inside the view (const for const view)
+ */
+template <
+        typename Tuple,
+        typename View
+        >
+struct kept_tuple<Tuple, View&>
+{
+    using type = typename std::conditional<std::is_const<View>::value, const Tuple&, Tuple&>::type;
+};
+
+/**
+ * @brief Pass a tuple stored as Stored by index_view of type View to a view created from it
+ * Rvalue view hands its kept_boxes over as they are, so no element is moved.
+ */
+template <
+        typename Stored,
+        typename View
+        >
+struct passed_tuple
+{
+    using type = Stored&&;
+
+    static type pass(Stored& stored)
+    {
+        return std::forward<Stored>(stored);
+    }
+};
+
+/**
+ * @brief Lvalue view passes references to the tuples it keeps (const for const view)
+ */
+template <
+        typename Stored,
+        typename View
+        >
+struct passed_tuple<Stored, View&>
+{
+    using stored_ref = typename std::conditional<std::is_const<View>::value, const Stored&, Stored&>::type;
+    using type = decltype(kept_get(std::declval<stored_ref>()));
+
+    static type pass(stored_ref stored)
+    {
+        return kept_get(stored);
+    }
+};
+
+/**
+ * @brief Describe index_view argument of view operations, its map and tuples are taken over
+ * Rvalue views pass their tuples on, lvalue views only references to them, so lvalue views could be
+ * composed further and must outlive the views created from them.
+ */
+template <
+        typename View,
+        typename Map,
+        typename... Tuples
+        >
+struct view_traits<View, index_view<Map, Tuples...>>
+{
+    using map = Map;
+    using tuples = type_list<typename kept_tuple<Tuples, View>::type...>;
+
+    static std::tuple<typename passed_tuple<typename kept_storage<Tuples>::type, View>::type...> refs(View&& view)
+    {
+        return refs_det(view, index_sequence_for<Tuples...>());
+    }
+
+    template <
+            std::size_t... I
+            >
+    static std::tuple<typename passed_tuple<typename kept_storage<Tuples>::type, View>::type...>
+    refs_det(View& view, index_sequence<I...>)
+    {
+        return std::tuple<typename passed_tuple<typename kept_storage<Tuples>::type, View>::type...>(
+                    passed_tuple<typename kept_storage<Tuples>::type, View>::pass(std::get<I>(view.tuples))...
+                );
+    }
+};
+
+/**
+ * @brief Total number of elements of tuples from type_list
+ */
+template <
+        typename Tuples
+        >
+struct tsize_sum_list;
+
+template <
+        typename... Tuples
+        >
+struct tsize_sum_list<type_list<Tuples...>> : tsize_sum<Tuples...>
+{ };
+
+/**
+ * @brief Decay all types from type_list, types of materialized elements
+ */
+template <
+        typename List
+        >
+struct decay_list;
+
+template <
+        typename... T
+        >
+struct decay_list<type_list<T...>>
+{
+    using type = type_list<typename std::decay<T>::type...>;
+};
+
+//forward declaration
+template <
+        typename First,
+        typename Second,
+        typename... Rest
+        >
+struct view_merge_type;
+
+/**
+ * @brief Type of two views merged together, map of the second one is moved past elements of the first one
+ */
+template <
+        typename First,
+        typename Second
+        >
+struct view_merge_type<First, Second>
+{
+    using map = typename sequence_cat<
+        typename view_traits<First>::map,
+        typename sequence_offset<
+            tsize_sum_list<typename view_traits<First>::tuples>::value,
+            typename view_traits<Second>::map
+        >::type
+    >::type;
+    using type = typename index_view_type<
+        map,
+        typename type_list_cat<typename view_traits<First>::tuples, typename view_traits<Second>::tuples>::type
+    >::type;
+};
+
+/**
+ * @brief Type of more than two views merged together, the first two are merged first
+ */
+template <
+        typename First,
+        typename Second,
+        typename Third,
+        typename... Rest
+        >
+struct view_merge_type<First, Second, Third, Rest...> :
+        view_merge_type<typename view_merge_type<First, Second>::type, Third, Rest...>
+{ };
+
+/**
+ * @brief Type of index_view with map of View composed with index map Seq
+ */
+template <
+        typename View,
+        typename Seq
+        >
+struct view_pick_type : index_view_type<
+        typename sequence_compose<typename view_traits<View>::map, Seq>::type,
+        typename view_traits<View>::tuples
+    >
+{ };
+
+/**
+ * @brief Create std::tuple with elements of index_view, Ret is constructed once from all elements
+ */
+template <
+        typename Ret,
+        typename View,
+        std::size_t... I
+        >
+Ret materialize_view(View&& view, index_sequence<I...>)
+{
+    return Ret(tuple_get<I>(std::forward<View>(view))...);
+}
+
+} //namespace details
+///@endinternal
+
+/**
+ * @brief Lazy tuple made of elements of other std::tuples picked by one compile-time index map.
+ * Map holds positions in the concatenation of all viewed tuples, so structural operations
+ * (tuple_utils::view_merge, tuple_utils::view_pick, tuple_utils::view_reverse) only compose index maps
+ * with tuple_utils::sequence_compose and no element is touched until the view is consumed. Then
+ * tuple_utils::materialize creates the result once and tuple_utils::explode passes elements straight
+ * from the viewed tuples, e.g. materialize(view_reverse(view_pick<...>(view_merge(a, b)))) copies each
+ * element once while reverse(make_custom_tuple<...>(merge(a, b))) copies it three times.
+ * std::tuple_size and std::tuple_element are specialized as for merged_view.
+ * Lvalue tuples are kept by reference and rvalue tuples are moved into the view, as merged_view and
+ * c_product_view do, so auto v = view_merge(std::make_tuple(1), t) is valid as long as t is. Each rvalue
+ * tuple is moved once into its own allocation (details::kept_box), view operations applied to an rvalue
+ * view take those allocations over without moving any element and materialize moves elements out of
+ * them, so a pipeline of views over rvalue tuples moves each element twice. Operations applied to an
+ * lvalue view reference the tuples it keeps.
+ * @tparam Map - index_sequence with positions in the concatenation of viewed tuples
+ * @tparam Tuples - types of viewed std::tuples, lvalue references for lvalue arguments
+ */
+template <
+        typename Map,
+        typename... Tuples
+        >
+struct index_view
+{
+    /** Where each element of the concatenation of viewed tuples comes from */
+    using concatenation = details::concat_indices<size_bare<Tuples>::value...>;
+    /** Index of the viewed tuple which contains each element */
+    using source = typename sequence_compose<typename concatenation::source, Map>::type;
+    /** Index of each element inside the viewed tuple which contains it */
+    using offset = typename sequence_compose<typename concatenation::offset, Map>::type;
+    /** Types of elements, in order */
+    using types = typename details::merged_view_types<type_list<Tuples...>, source, offset>::type;
+
+    /**
+     * @brief Create view from references to the viewed tuples, usually called through view operations
+     * Rvalue tuples are moved into kept_boxes, kept_boxes of other views are taken over.
+     */
+    template <
+            typename... Refs
+            >
+    explicit index_view(std::tuple<Refs...>&& refs)
+        : index_view(std::move(refs), index_sequence_for<Refs...>())
+    { }
+
+    /**
+     * @brief References to the viewed lvalue std::tuples and kept_boxes with rvalue ones
+     */
+    std::tuple<typename details::kept_storage<Tuples>::type...> tuples;
+
+private:
+    template <
+            typename... Refs,
+            std::size_t... I
+            >
+    index_view(std::tuple<Refs...>&& refs, index_sequence<I...>)
+        : tuples(std::get<I>(std::move(refs))...)
+    { }
+};
+
+/**
+ * @brief Create index_view with all elements of given std::tuples, as if they were merged
+ */
+template <
+        typename... Tuples
+        >
+index_view<make_index_sequence<tsize_sum<Tuples...>::value>, Tuples...> make_index_view(Tuples&&... tuples)
+{
+    return index_view<make_index_sequence<tsize_sum<Tuples...>::value>, Tuples...>(
+                std::tuple<Tuples&&...>(std::forward<Tuples>(tuples)...)
+            );
+}
+
+/**
+ * @brief Lazy tuple_utils::merge, arguments are std::tuples or index_views
+ */
+template <
+        typename First,
+        typename Second
+        >
+typename details::view_merge_type<First, Second>::type view_merge(First&& first, Second&& second)
+{
+    return typename details::view_merge_type<First, Second>::type(std::tuple_cat(
+                details::view_traits<First>::refs(std::forward<First>(first)),
+                details::view_traits<Second>::refs(std::forward<Second>(second))
+            ));
+}
+
+/**
+ * @brief Lazy tuple_utils::merge of more than two std::tuples or index_views
+ */
+template <
+        typename First,
+        typename Second,
+        typename Third,
+        typename... Rest
+        >
+typename details::view_merge_type<First, Second, Third, Rest...>::type view_merge(First&& first, Second&& second,
+                                                                                 Third&& third, Rest&&... rest)
+{
+    return view_merge(
+                view_merge(std::forward<First>(first), std::forward<Second>(second)),
+                std::forward<Third>(third),
+                std::forward<Rest>(rest)...
+            );
+}
+
+/**
+ * @brief Lazy tuple_utils::make_custom_tuple, I-th element of the result is Sequence[I]-th element of view
+ * Example:
+ * @code
+ *    auto t1 = std::make_tuple(1, 2.5);
+ *    auto t2 = std::make_tuple('x', "y");
+ *    auto result = tuple_utils::materialize(
+ *        tuple_utils::view_reverse(tuple_utils::view_pick<0, 2, 3>(tuple_utils::view_merge(t1, t2)))
+ *    );
+ *    //result is std::tuple<const char*, char, int> with values ("y", 'x', 1), each element copied once
+ * @endcode
+ */
+template <
+        std::size_t... Sequence,
+        typename View
+        >
+typename details::view_pick_type<View, index_sequence<Sequence...>>::type view_pick(View&& view)
+{
+    return typename details::view_pick_type<View, index_sequence<Sequence...>>::type(
+                details::view_traits<View>::refs(std::forward<View>(view))
+            );
+}
+
+/**
+ * @brief Lazy tuple_utils::make_custom_tuple with indices taken from index_sequence
+ */
+template <
+        typename View,
+        std::size_t... Sequence
+        >
+typename details::view_pick_type<View, index_sequence<Sequence...>>::type view_pick(View&& view,
+                                                                                   index_sequence<Sequence...>)
+{
+    return view_pick<Sequence...>(std::forward<View>(view));
+}
+
+/**
+ * @brief Lazy tuple_utils::reverse
+ */
+template <
+        typename View
+        >
+auto view_reverse(View&& view)
+-> decltype(view_pick(
+                std::forward<View>(view),
+                typename sequence_reverse<make_index_sequence<size_bare<View>::value>>::type()
+            ))
+{
+    return view_pick(
+                std::forward<View>(view),
+                typename sequence_reverse<make_index_sequence<size_bare<View>::value>>::type()
+            );
+}
+
+/**
+ * @brief Get reference to the element at index I of index_view
+ * Returns lvalue reference into the viewed tuple (const if the viewed tuple is const or kept by the view).
+ */
+template <
+        std::size_t I,
+        typename Map,
+        typename... Tuples
+        >
+auto get(const index_view<Map, Tuples...>& view)
+-> decltype(details::tuple_get<details::sequence_array<typename index_view<Map, Tuples...>::offset>::value[I]>(
+                details::kept_get(
+                    std::get<details::sequence_array<typename index_view<Map, Tuples...>::source>::value[I]>(view.tuples)
+                )
+            ))
+{
+    using view_type = index_view<Map, Tuples...>;
+    static_assert(I < details::sequence_array<Map>::size, "Too big indice");
+    return details::tuple_get<details::sequence_array<typename view_type::offset>::value[I]>(
+                details::kept_get(std::get<details::sequence_array<typename view_type::source>::value[I]>(view.tuples))
+            );
+}
+
+/**
+ * @brief Get element at index I of rvalue index_view
+ * Elements of tuples kept by the view are returned as rvalue references when the view uses them only
+ * once, elements used more than once are returned as lvalue references, as in make_custom_tuple.
+ */
+template <
+        std::size_t I,
+        typename Map,
+        typename... Tuples
+        >
+auto get(index_view<Map, Tuples...>&& view)
+-> decltype(details::element_forwarder<
+                details::count_value(
+                    details::sequence_array<Map>::value, 0, details::sequence_array<Map>::size,
+                    details::sequence_array<Map>::value[I]
+                ) == 1
+            >::template get<details::sequence_array<typename index_view<Map, Tuples...>::offset>::value[I]>(
+                details::kept_get(std::get<details::sequence_array<typename index_view<Map, Tuples...>::source>::value[I]>(
+                    std::move(view.tuples)
+                ))
+            ))
+{
+    using view_type = index_view<Map, Tuples...>;
+    using indices = details::sequence_array<Map>;
+    static_assert(I < indices::size, "Too big indice");
+    return details::element_forwarder<
+                details::count_value(indices::value, 0, indices::size, indices::value[I]) == 1
+            >::template get<details::sequence_array<typename view_type::offset>::value[I]>(
+                details::kept_get(std::get<details::sequence_array<typename view_type::source>::value[I]>(
+                    std::move(view.tuples)
+                ))
+            );
+}
+
+/**
+ * @brief Create std::tuple with copies of all index_view elements, each element is copied once
+ */
+template <
+        typename Map,
+        typename... Tuples
+        >
+auto materialize(const index_view<Map, Tuples...>& view)
+-> typename to_tuple<typename details::decay_list<typename index_view<Map, Tuples...>::types>::type>::type
+{
+    using result = typename to_tuple<typename details::decay_list<typename index_view<Map, Tuples...>::types>::type>::type;
+    return details::materialize_view<result>(view, make_index_sequence<details::sequence_array<Map>::size>());
+}
+
+/**
+ * @brief Create std::tuple from rvalue index_view, elements of tuples viewed as rvalues are moved
+ * unless they are used more than once
+ */
+template <
+        typename Map,
+        typename... Tuples
+        >
+auto materialize(index_view<Map, Tuples...>&& view)
+-> typename to_tuple<typename details::decay_list<typename index_view<Map, Tuples...>::types>::type>::type
+{
+    using result = typename to_tuple<typename details::decay_list<typename index_view<Map, Tuples...>::types>::type>::type;
+    return details::materialize_view<result>(
+                std::move(view),
+                make_index_sequence<details::sequence_array<Map>::size>()
+            );
+}
+
+/**
+ * @brief index_view elements are described by its types member
+ */
+template <
+        typename Map,
+        typename... Tuples
+        >
+struct to_type_list<index_view<Map, Tuples...>>
+{
+    using type = typename index_view<Map, Tuples...>::types;
+};
+
+} //namespace tuple_utils
+
+namespace std
+{
+
+/**
+ * @brief Size of index_view is equal to the size of its index map
+ */
+template <
+        typename Map,
+        typename... Tuples
+        >
+struct tuple_size<tuple_utils::index_view<Map, Tuples...>> :
+        std::integral_constant<std::size_t, tuple_utils::details::sequence_array<Map>::size>
+{ };
+
+/**
+ * @brief Type of I-th element of index_view
+ */
+template <
+        std::size_t I,
+        typename Map,
+        typename... Tuples
+        >
+struct tuple_element<I, tuple_utils::index_view<Map, Tuples...>> :
+        tuple_utils::type_at<I, typename tuple_utils::index_view<Map, Tuples...>::types>
+{ };
+
+} //namespace std
+
+#endif // INDEX_VIEW_H
@@ -1,8 +1,13 @@
 #ifndef MAKE_CUSTOM_TUPLE_H
 #define MAKE_CUSTOM_TUPLE_H
 
+#include "aux/get.hpp"
 #include "aux/sequence.hpp"
+#include "aux/sequence_algebra.hpp"
+#include "aux/type_list.hpp"
 #include <tuple>
+#include <type_traits>
+#include <utility>
 
 /**
  * @file
@@ -17,76 +22,20 @@ namespace tuple_utils
 namespace details
 {
 
-/**
- *@brief Assign value of the second argument to the first one.
- *Templated helper function implementing simple assignment. It can be expanded with parameter 
- *packet expansion which is impossible for assignment operator.
- *@param left - reference to assignee
- *@param right - const reference to assignor
- */
-template <typename L, typename R>
-void assign(L& left, const R& right)
-{
-    left = right;
-}
-
 /**
  *@brief Struct to extract std::tuple types based on sequence.
  *Extract std::tuple types from type template parameter Tuple based on variadic non-type parameter 
- *Sequence
- */
-template <
-        typename Tuple,
-        int... Sequence
-        >
-struct tupleTypeFromSequence;
-
-/**
- *@brief Recursive step of tupleTypeFromSequence.
+ *Sequence. Sequence is used as an index map, so whole type is built with one pack expansion.
  */
 template <
         typename Tuple,
-        int First,
-        int... Sequence
+        std::size_t... Sequence
         >
-struct tupleTypeFromSequence<Tuple, First, Sequence...>
+struct tupleTypeFromSequence
 {
     using CTuple = typename std::decay<Tuple>::type;
-    static_assert(First < std::tuple_size<CTuple>::value, "Too big indice");
-    using type = decltype(std::tuple_cat(
-    std::declval<std::tuple<typename std::tuple_element<First, CTuple>::type>>(),
-    std::declval<typename tupleTypeFromSequence<CTuple, Sequence...>::type>()
-    ));
-};
-
-/**
- *@brief Last recursive instantiation of tupleTypeFromSequence struct.
- */
-template <
-        typename Tuple,
-        int BeforeLast,
-        int Last
-        >
-struct tupleTypeFromSequence<Tuple, BeforeLast, Last>
-{
-    using CTuple = typename std::decay<Tuple>::type;
-    static_assert(BeforeLast < std::tuple_size<CTuple>::value &&
-        Last < std::tuple_size<CTuple>::value, "Too big indice");
-    using type = std::tuple<
-        typename std::tuple_element<BeforeLast, CTuple>::type,
-        typename std::tuple_element<Last, CTuple>::type
-    >;
-};
-
-/**
- *@brief Special case for calling make_custom_tuple without any indices (i.e. requesting empty tuple)
- */
-template <
-        typename Tuple
-        >
-struct tupleTypeFromSequence<Tuple>
-{
-    using type = std::tuple<>;
+    static_assert(all_of<(Sequence < std::tuple_size<CTuple>::value)...>::value, "Too big indice");
+    using type = std::tuple<typename tuple_type_at<Sequence, CTuple>::type...>;
 };
 
 /**
@@ -94,37 +43,38 @@ struct tupleTypeFromSequence<Tuple>
  */
 template <
         typename Tuple,
-        int... Sequence
+        std::size_t... Sequence
         >
 struct partitionTuple
 {
     /** std::tuple type set by tupleTypeFromSequence. */
     using PartitionType = typename tupleTypeFromSequence<Tuple, Sequence...>::type;
-    /** sequence pack created based on non-type template parameter Sequence. */
-    static constexpr auto range = typename make_sequence<std::tuple_size<PartitionType>::value>::type();
+    /** Sequence kept in constexpr array, used to count how many times each index is used. */
+    using Indices = sequence_array<index_sequence<Sequence...>>;
+
+    /**
+     *@brief Check if element at index I could be moved from the base tuple.
+     *Element is moved only when base tuple is an rvalue and index I is used exactly once, otherwise
+     *the same element could be moved from twice.
+     */
+    template <std::size_t I>
+    struct forward_element : std::integral_constant<bool,
+        !std::is_lvalue_reference<Tuple>::value && count_value(Indices::value, 0, Indices::size, I) == 1>
+    { };
 
     /**
-     *@brief Create and fill custom tuple.
+     *@brief Create custom tuple.
      *Used by the helper function make_custom_tuple which wraps part of its internals so they are 
-     *invisible to the user.
-     *@param sequence<Is...> - sequence pack used for expansion, contains sequence 0, 1, 2... N 
-     *where N is the number of elements in the destination
-     *@param source - base tuple
+     *invisible to the user. Destination is constructed directly from the base tuple elements, so
+     *element types do not need to be default constructible nor copy assignable.
+     *@param source - base tuple, forwarded from make_custom_tuple
      *@return destination - std::tuple with values taken from base tuple based on sequence
      */
-    template<int... Is>
-    static PartitionType part(sequence<Is...>, Tuple source)
+    static PartitionType part(Tuple&& source)
     {
-        PartitionType destination;
-
-        /* unused[] - dummy type used for parameter pack expansion at compile time. Compiler tries 
-        to fill unused, but it must first evaluate first coma operator operand which performs 
-        assignment. Whole operation is repeated with parameter pack expansion up to the last value 
-        in the sequence<Is> range */
-        int unused[] = {0, (assign(std::get<Is>(destination), std::get<Sequence>(source)), 1)...};
-        (void)unused;
-
-        return destination;
+        return PartitionType(
+            element_forwarder<forward_element<Sequence>::value>::template get<Sequence>(std::forward<Tuple>(source))...
+        );
     }
 };
 
@@ -135,10 +85,11 @@ struct partitionTuple
  *@brief Create tuple from existing tuple based on given sequence.
  *Based on the type of tuple given as an argument and sequence specified as a template parameters 
  *returns a std::tuple with types and values corresponding to the base tuple. It is possible to use 
- *the same sequence more than once.
+ *the same sequence more than once. Elements of an rvalue tuple are moved, unless their index is used
+ *more than once, then they are copied.
  *@tparam Sequence - integers indicating which base tuple values are to be used in constructing 
  *custom tuple
- *@param tuple - reference to constant std::tuple
+ *@param tuple - std::tuple, forwarded
  *@return custom std::tuple
  *
  * Example Usage:
@@ -149,20 +100,36 @@ struct partitionTuple
  * @endcode
  */
 template <
-        int... Sequence,
+        std::size_t... Sequence,
         typename Tuple
         >
 auto make_custom_tuple(Tuple&& tuple)
--> decltype( 
-    details::partitionTuple<Tuple, Sequence...>::part(
-        details::partitionTuple<Tuple, Sequence...>::range, 
-        std::forward<Tuple>(tuple)
-    ))
+-> typename details::partitionTuple<Tuple, Sequence...>::PartitionType
+{
+    return details::partitionTuple<Tuple, Sequence...>::part(std::forward<Tuple>(tuple));
+}
+
+/**
+ *@brief Create tuple from existing tuple based on sequence given as an argument.
+ *Behaves in the same way as make_custom_tuple with indices given as template parameters, but takes 
+ *them from index_sequence (i.e. std::index_sequence in C++14), so index packs computed elsewhere 
+ *could be used directly.
+ *
+ * Example Usage:
+ * @code
+ *    auto base_tuple = std::make_tuple(2, 4.4, "string");
+ *    auto custom_tuple = tuple_util::make_custom_tuple(base_tuple, std::index_sequence<2, 0>());
+ *    //create std::tuple<const char*, int> custom_tuple{"string", 2};
+ * @endcode
+ */
+template <
+        typename Tuple,
+        std::size_t... Sequence
+        >
+auto make_custom_tuple(Tuple&& tuple, index_sequence<Sequence...>)
+-> decltype(make_custom_tuple<Sequence...>(std::forward<Tuple>(tuple)))
 {
-    return details::partitionTuple<Tuple, Sequence...>::part(
-        details::partitionTuple<Tuple, Sequence...>::range, 
-        std::forward<Tuple>(tuple)
-    );
+    return make_custom_tuple<Sequence...>(std::forward<Tuple>(tuple));
 }
 
 } //namespace tuple_utils
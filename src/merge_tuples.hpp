@@ -2,6 +2,12 @@
 #define MERGE_TUPLES_H
 
 #include <tuple>
+#include <type_traits>
+#include "aux/get.hpp"
+#include "aux/sequence.hpp"
+#include "aux/sequence_algebra.hpp"
+#include "aux/traits.hpp"
+#include "aux/type_list.hpp"
 
 /**
  * @file
@@ -16,148 +22,41 @@ namespace tuple_utils
 namespace details
 {
 
-//Forward declaration
-template <typename...>
-struct merge_tuples_type;
-
 /**
  * @brief Obtain type of few std::tuples merged together
  * For example merge of std::tuple<int, float, double>, std::tuple<std::string> and std::tuple<long, short>
- * will yield type std::tuple<int, float, double, std::string, long, short>
- */
-template <
-        typename... Args1,
-        typename... Args2,
-        typename... Rest
-        >
-struct merge_tuples_type<std::tuple<Args1...>, std::tuple<Args2...>, Rest...>
-{
-    using type = typename merge_tuples_type<std::tuple<Args1..., Args2...>, Rest...>::type;
-};
-
-/**
- * @brief Get type of two std::tuples merged together
- * Last recursive step of merge_tuples_type<>::type where type member is std::tuple of types from
- * both tuples given as parameters
+ * will yield type std::tuple<int, float, double, std::string, long, short>. Types are concatenated by
+ * type_list_cat, so the instantiation depth does not grow with the number of merged tuples.
  */
 template <
-        typename... Args1,
-        typename... Args2
+        typename... Tuples
         >
-struct merge_tuples_type<std::tuple<Args1...>, std::tuple<Args2...>>
+struct merge_tuples_type
 {
-    using type = std::tuple<Args1..., Args2...>;
+    using type = typename to_tuple<
+        typename type_list_cat<typename to_type_list<typename std::decay<Tuples>::type>::type...>::type
+    >::type;
 };
 
-//forward declaration
-template <typename...>
-struct merge_tuples_det;
-
 /**
- *@brief Helper struct used by the tuple_utils::merge to fill std::tuple which is returned as a result.
+ * @brief Helper function used by tuple_utils::merge to construct the result directly from the arguments.
+ * k-th element of the result is the element at position Offset[k] of the argument at position Source[k].
+ * Arguments are kept in std::tuple of references, taking it as an rvalue makes std::get return rvalue
+ * references for arguments passed as rvalues, so their elements are moved and elements of lvalue
+ * arguments are copied. Elements are read with tuple_get, so views such as c_product_view could be merged.
+ * @tparam Ret - type of std::tuple returned by tuple_utils::merge
+ * @param args - std::tuple of references to tuple_utils::merge arguments (from std::forward_as_tuple)
  */
 template <
-        typename... Args1,
-        typename... Args2,
-        typename... RestArgs
+        typename Ret,
+        std::size_t... Source,
+        std::size_t... Offset,
+        typename Args
         >
-struct merge_tuples_det<std::tuple<Args1...>, std::tuple<Args2...>, RestArgs...>
+Ret merge_det(index_sequence<Source...>, index_sequence<Offset...>, Args&& args)
 {
-    using Ret = typename merge_tuples_type<std::tuple<Args1...>, std::tuple<Args2...>, RestArgs...>::type;
-
-    /**
-    * @brief For each tuple from merge function arguments copy its content to the resulting std::tuple
-    * Called recursively with the recursion depth equal to the size of currently processed std::tuple
-    * (i.e. ArgEnd value). In each step copy one value from processed std::tuple to the result and call
-    * merge_unroll for the next element, until the end of the currently processed std::tuple.
-    * @tparam ResultCurr - current position in result-from-merge std::tuple, each time updated by 1
-    * @tparam ArgBegin - current position in the current std::tuple given as merge argument
-    * @tparam ArgEnd - size of one of current std::tuple given as merge argument, used to stop unrolling
-    */
-    template <
-            std::size_t ResultCurr,
-            std::size_t ArgBegin,
-            std::size_t ArgEnd
-            >
-    struct merge_unroll
-    {
-        /**
-        * @brief Copy one value from arg to the result, called recursively.
-        * Copy value from the ArgBegin position from arg to the result at the ResultCurr position.
-        * Recursively called for the next element, so it increases both ResultCurr and ArgBegin
-        */
-        template <
-                typename... ResArgs,
-                typename... VarArgs
-                >
-        static void go(std::tuple<ResArgs...>& result, const std::tuple<VarArgs...>& arg)
-        {
-            std::get<ResultCurr>(result) = std::get<ArgBegin>(arg);
-            merge_unroll<ResultCurr + 1, ArgBegin + 1, ArgEnd>::go(result, arg);
-        }
-    };
-
-    /**
-    * @brief Last step in the loop unroll, ends processing of one of the merge function arguments
-    * Hit when currently used position is the same as the size of the argument
-    * @tparam ResultCurr - position at which result should be inserted
-    * @tparam ArgEnd - size of the processed argument, indicates last loop unroll step
-    */
-    template <
-            std::size_t ResultCurr,
-            std::size_t ArgEnd
-            >
-    struct merge_unroll<ResultCurr, ArgEnd, ArgEnd>
-    {
-        /**
-        * @brief Last recursive call, all values are copied so it does nothing
-        */
-        template <
-                typename... ResArgs,
-                typename... VarArgs
-                >
-        static void go(std::tuple<ResArgs...>&, const std::tuple<VarArgs...>&)
-        { }
-    };
-
-    /**
-    * @brief Helper struct which is used to fill std::tuple returned by the merge function
-    * Recursively call merge_unroll for each std::tuple given as argument to the merge function. In
-    * merge_unroll std::tuple which will be returned is filled piece by piece.
-    * @tparam ResType - type of result which will be returned by merge function
-    * @tparam ResultCurr - position in result at which merge_unroll will add values from merge arguments
-    */
-    template <
-            typename ResType,
-            std::size_t ResultCurr
-            >
-    struct merge_helper
-    {
-        /**
-        * @brief Last step of overloaded go(std::tuple<ResArgs...>&, std::tuple<Args...>&, Rest&...) function
-        * Invoked with only one std::tuple (result). There are no arguments left, do nothing and end recursion
-        */
-        static void go(const ResType&)
-        {}
-
-        /**
-        * @brief Function that copies all values from arguments to the result
-        * Recursively unroll one std::tuple and copy its value, then recursively process and unroll next arguments
-        * until there is no argument left
-        * @param result - std::tuple which will be returned by the tuple_utils::merge
-        * @param tuple1, rest... - arguments of tuple_utils::merge, used to fill result with values
-        */
-        template <
-                typename... Args,
-                typename... Rest
-                >
-        static void go(ResType& result, const std::tuple<Args...>& tuple1, const Rest&... rest)
-        {
-            merge_unroll<ResultCurr, 0, sizeof...(Args)>::go(result, tuple1);
-            merge_helper<ResType, ResultCurr + sizeof...(Args)>::go(result, rest...);
-        }
-    };
-};
+    return Ret(tuple_get<Offset>(std::get<Source>(std::forward<Args>(args)))...);
+}
 
 } //namespace details
 ///@endinternal
@@ -165,7 +64,8 @@ struct merge_tuples_det<std::tuple<Args1...>, std::tuple<Args2...>, RestArgs...>
 /**
  * @brief Merge few std::tuples into one using their values
  * Takes any number of heterogenous std::tuples and returns an aggregate std::tuple that contains each
- * value from the given arguments, in order.
+ * value from the given arguments, in order. Result is constructed directly from the arguments, so its
+ * elements do not have to be default constructible. Elements of arguments passed as rvalues are moved.
  * @param tuple1, tuple2, rest... - at least two possibly heterogenous std::tuples
  * @return std::tuple with values from all std::tuples passed as arguments
  *
@@ -179,35 +79,34 @@ struct merge_tuples_det<std::tuple<Args1...>, std::tuple<Args2...>, RestArgs...>
  * @endcode
  */
 template <
-        typename... Args1,
-        typename... Args2,
+        typename Tuple1,
+        typename Tuple2,
         typename... Rest
         >
-auto merge(const std::tuple<Args1...>& tuple1, const std::tuple<Args2...>& tuple2, const Rest&... rest)
--> typename details::merge_tuples_det<std::tuple<Args1...>, std::tuple<Args2...>, Rest...>::Ret
+auto merge(Tuple1&& tuple1, Tuple2&& tuple2, Rest&&... rest)
+-> typename details::merge_tuples_type<Tuple1, Tuple2, Rest...>::type
 {
-     using Ret = typename details::merge_tuples_det<std::tuple<Args1...>, std::tuple<Args2...>, Rest...>::Ret;
-     Ret result;
-
-     details::merge_tuples_det<
-             std::tuple<Args1...>,
-             std::tuple<Args2...>,
-             Rest...
-     >::template merge_helper<Ret, 0>::go(result, tuple1, tuple2, rest...);
-
-     return result;
+    using Ret = typename details::merge_tuples_type<Tuple1, Tuple2, Rest...>::type;
+    using indices = details::concat_indices<size_bare<Tuple1>::value, size_bare<Tuple2>::value, size_bare<Rest>::value...>;
+
+    return details::merge_det<Ret>(
+                typename indices::source(),
+                typename indices::offset(),
+                std::forward_as_tuple(std::forward<Tuple1>(tuple1), std::forward<Tuple2>(tuple2), std::forward<Rest>(rest)...)
+            );
 }
 
 /**
  *@brief Overload for calling tuple_utils::merge with only one argument
- *Special case which returns only a copy of the given argument
+ *Special case which returns only a copy of the given argument (or moves it if it is an rvalue)
  */
 template <
-        typename... Args
+        typename Tuple
         >
-std::tuple<Args...> merge(const std::tuple<Args...>& arg)
+auto merge(Tuple&& arg)
+-> typename details::merge_tuples_type<Tuple>::type
 {
-    return arg;
+    return std::forward<Tuple>(arg);
 }
 
 } //namespace tuple_utils
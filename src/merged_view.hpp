@@ -0,0 +1,233 @@
+#ifndef MERGED_VIEW_H
+#define MERGED_VIEW_H
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "aux/get.hpp"
+#include "aux/sequence.hpp"
+#include "aux/sequence_algebra.hpp"
+#include "aux/traits.hpp"
+#include "aux/type_list.hpp"
+#include "merge_tuples.hpp"
+
+/**
+ * @file
+ * @author
+ * @version
+*/
+
+//! Utilities for tuples manipulation
+namespace tuple_utils
+{
+
+//forward declaration
+template <typename... Tuples>
+struct merged_view;
+
+///@internal
+namespace details
+{
+
+//forward declaration
+template <
+        typename Lists,
+        typename Source,
+        typename Offset
+        >
+struct merged_view_types;
+
+/**
+ * @brief Obtain types of merged_view elements, k-th type is the type at Offset[k] in Tuples[Source[k]]
+ * Cv qualifiers of the viewed std::tuples are kept, as for std::tuple_element.
+ */
+template <
+        typename... Tuples,
+        std::size_t... Source,
+        std::size_t... Offset
+        >
+struct merged_view_types<type_list<Tuples...>, index_sequence<Source...>, index_sequence<Offset...>>
+{
+    using type = type_list<typename tuple_type_at<
+        Offset,
+        typename std::remove_reference<typename type_at<Source, type_list<Tuples...>>::type>::type
+    >::type...>;
+};
+
+} //namespace details
+///@endinternal
+
+/**
+ * @brief Lazy concatenation of std::tuples which keeps only references to lvalue tuples.
+ * Behaves as the std::tuple returned by tuple_utils::merge for the same arguments, but elements of lvalue
+ * tuples are not copied. Rvalue tuples are moved into the view, as c_product_view and zipped_range do.
+ * Each index I is mapped at compile time to the viewed tuple and the position inside it (see
+ * details::concat_indices), so tuple_utils::get<I> is as cheap as std::get on the source tuple.
+ * std::tuple_size and std::tuple_element are specialized, so merged_view could be passed to
+ * tuple_utils::explode, tuple_utils::fold, tuple_utils::zip and printed with operator<<.
+ * merged_view should not outlive the viewed lvalue tuples, it is intended to be consumed by one call.
+ * @tparam Tuples - types of viewed std::tuples, lvalue references for lvalue arguments of make_merged_view
+ */
+template <
+        typename... Tuples
+        >
+struct merged_view
+{
+    /** Where each element comes from, source is the index of the viewed tuple, offset is the index inside it */
+    using indices = details::concat_indices<size_bare<Tuples>::value...>;
+    /** Types of elements, in order */
+    using types = typename details::merged_view_types<
+        type_list<Tuples...>,
+        typename indices::source,
+        typename indices::offset
+    >::type;
+
+    /**
+     * @brief Create view of given std::tuples, usually called through tuple_utils::make_merged_view
+     */
+    explicit merged_view(Tuples&&... tuples)
+        : tuples(std::forward<Tuples>(tuples)...)
+    { }
+
+    /**
+     * @brief References to the viewed lvalue std::tuples and copies of rvalue ones
+     */
+    std::tuple<Tuples...> tuples;
+};
+
+/**
+ * @brief Create merged_view of given std::tuples
+ * Example:
+ * @code
+ *    auto t1 = std::make_tuple(1, 2);
+ *    auto t2 = std::make_tuple("x");
+ *    auto view = tuple_utils::make_merged_view(t1, t2);
+ *    tuple_utils::get<2>(view); //"x", the same object as std::get<0>(t2)
+ *    tuple_utils::explode(f, view); //calls f(1, 2, "x") without creating merged std::tuple
+ * @endcode
+ */
+template <
+        typename... Tuples
+        >
+merged_view<Tuples...> make_merged_view(Tuples&&... tuples)
+{
+    return merged_view<Tuples...>(std::forward<Tuples>(tuples)...);
+}
+
+/**
+ * @brief Get reference to the element at index I of merged_view
+ * Returns lvalue reference into the viewed tuple (const if the viewed tuple is const or kept by the view).
+ */
+template <
+        std::size_t I,
+        typename... Tuples
+        >
+auto get(const merged_view<Tuples...>& view)
+-> decltype(details::tuple_get<details::sequence_array<typename merged_view<Tuples...>::indices::offset>::value[I]>(
+                std::get<details::sequence_array<typename merged_view<Tuples...>::indices::source>::value[I]>(view.tuples)
+            ))
+{
+    using indices = typename merged_view<Tuples...>::indices;
+    static_assert(I < details::sequence_array<typename indices::source>::size, "Too big indice");
+    return details::tuple_get<details::sequence_array<typename indices::offset>::value[I]>(
+                std::get<details::sequence_array<typename indices::source>::value[I]>(view.tuples)
+            );
+}
+
+/**
+ * @brief Get element at index I of rvalue merged_view
+ * Elements of rvalue tuples moved into the view are returned as rvalue references, so they could be moved.
+ */
+template <
+        std::size_t I,
+        typename... Tuples
+        >
+auto get(merged_view<Tuples...>&& view)
+-> decltype(details::tuple_get<details::sequence_array<typename merged_view<Tuples...>::indices::offset>::value[I]>(
+                std::get<details::sequence_array<typename merged_view<Tuples...>::indices::source>::value[I]>(
+                    std::move(view.tuples)
+                )
+            ))
+{
+    using indices = typename merged_view<Tuples...>::indices;
+    static_assert(I < details::sequence_array<typename indices::source>::size, "Too big indice");
+    return details::tuple_get<details::sequence_array<typename indices::offset>::value[I]>(
+                std::get<details::sequence_array<typename indices::source>::value[I]>(std::move(view.tuples))
+            );
+}
+
+/**
+ * @brief Create std::tuple with copies of all merged_view elements, equal to the result of tuple_utils::merge
+ */
+template <
+        typename... Tuples
+        >
+auto materialize(const merged_view<Tuples...>& view)
+-> typename details::merge_tuples_type<Tuples...>::type
+{
+    using indices = typename merged_view<Tuples...>::indices;
+    return details::merge_det<typename details::merge_tuples_type<Tuples...>::type>(
+                typename indices::source(),
+                typename indices::offset(),
+                view.tuples
+            );
+}
+
+/**
+ * @brief Create std::tuple from rvalue merged_view, elements of rvalue tuples moved into the view are moved
+ */
+template <
+        typename... Tuples
+        >
+auto materialize(merged_view<Tuples...>&& view)
+-> typename details::merge_tuples_type<Tuples...>::type
+{
+    using indices = typename merged_view<Tuples...>::indices;
+    return details::merge_det<typename details::merge_tuples_type<Tuples...>::type>(
+                typename indices::source(),
+                typename indices::offset(),
+                std::move(view.tuples)
+            );
+}
+
+/**
+ * @brief merged_view elements are described by its types member
+ */
+template <
+        typename... Tuples
+        >
+struct to_type_list<merged_view<Tuples...>>
+{
+    using type = typename merged_view<Tuples...>::types;
+};
+
+} //namespace tuple_utils
+
+namespace std
+{
+
+/**
+ * @brief Size of merged_view is equal to the sum of sizes of viewed tuples
+ */
+template <
+        typename... Tuples
+        >
+struct tuple_size<tuple_utils::merged_view<Tuples...>> :
+        std::integral_constant<std::size_t, tuple_utils::tsize_sum<Tuples...>::value>
+{ };
+
+/**
+ * @brief Type of I-th element of merged_view
+ */
+template <
+        std::size_t I,
+        typename... Tuples
+        >
+struct tuple_element<I, tuple_utils::merged_view<Tuples...>> :
+        tuple_utils::type_at<I, typename tuple_utils::merged_view<Tuples...>::types>
+{ };
+
+} //namespace std
+
+#endif // MERGED_VIEW_H
@@ -5,6 +5,8 @@
 #include <iostream>
 #include <string>
 #include <sstream>
+#include <type_traits>
+#include "aux/get.hpp"
 
 /**
  * @file
@@ -19,6 +21,61 @@ namespace tuple_utils
 namespace details
 {
 
+/**
+ * @brief Check if Type is tuple-like, i.e. std::tuple_size is specialized for it
+ * True for std::tuple, std::pair, std::array and views from this library (merged_view, index_view,
+ * c_product_view), elements of such types are read with tuple_get.
+ */
+template <
+        typename Type,
+        typename = void
+        >
+struct is_tuple_like : std::false_type
+{ };
+
+template <
+        typename Type
+        >
+struct is_tuple_like<Type, decltype(void(std::tuple_size<Type>::value))> : std::true_type
+{ };
+
+} //namespace details
+///@endinternal
+} //namespace tuple_utils
+
+//forward declaration
+template <
+        typename CharT,
+        typename Traits,
+        typename... Args
+        >
+std::basic_ostream<CharT, Traits>&
+operator<< (std::basic_ostream<CharT, Traits>& str, const std::tuple<Args...>& tuple_arg);
+
+//forward declaration
+template <
+        typename CharT,
+        typename Traits
+        >
+std::basic_ostream<CharT, Traits>&
+operator<< (std::basic_ostream<CharT, Traits>& stream, const std::tuple<>&);
+
+//forward declaration
+template <
+        typename CharT,
+        typename Traits,
+        typename Tuple
+        >
+typename std::enable_if<tuple_utils::details::is_tuple_like<Tuple>::value, std::basic_ostream<CharT, Traits>&>::type
+operator<< (std::basic_ostream<CharT, Traits>& str, const Tuple& tuple_arg);
+
+//! Utilities for tuples manipulation
+namespace tuple_utils
+{
+///@internal
+namespace details
+{
+
 /**
  * @brief Helper struct used by operator<<(std::basic_ostream, std::tuple)
  * Contains method for putting tuple into stream and static members which are used for formatting 
@@ -52,7 +109,7 @@ struct tuple_printer
         static std::basic_ostream<CharT, Traits>& 
         execute(std::basic_ostream<CharT, Traits>& stream, const Type& tuple)
         {
-            stream << std::get<Start>(tuple) << tuple_printer::delim;
+            stream << tuple_get<Start>(tuple) << tuple_printer::delim;
             tuple_printer_det<CharT, Traits, Start + 1, Size, Type>::execute(stream, tuple);
             return stream;
         }
@@ -75,10 +132,41 @@ struct tuple_printer
         static std::basic_ostream<CharT, Traits>& 
         execute(std::basic_ostream<CharT, Traits>& stream, const Type& tuple)
         {
-            stream << std::get<Size>(tuple);
+            stream << tuple_get<Size>(tuple);
             return stream;
         }
     };
+
+    /**
+     * @brief Put tuple-like object with at least one element into the stream
+     */
+    template <
+            typename CharT,
+            typename Traits,
+            typename Type
+            >
+    static std::basic_ostream<CharT, Traits>&
+    print(std::basic_ostream<CharT, Traits>& stream, const Type& tuple, std::false_type)
+    {
+        stream << tuple_printer::lbrace;
+        tuple_printer_det<CharT, Traits, 0, std::tuple_size<Type>::value - 1, Type>::execute(stream, tuple);
+        stream << tuple_printer::rbrace;
+        return stream;
+    }
+
+    /**
+     * @brief Empty tuple-like object is not printed at all, return stream as-is
+     */
+    template <
+            typename CharT,
+            typename Traits,
+            typename Type
+            >
+    static std::basic_ostream<CharT, Traits>&
+    print(std::basic_ostream<CharT, Traits>& stream, const Type&, std::true_type)
+    {
+        return stream;
+    }
 };
 
 std::string tuple_printer::delim = ", ";
@@ -137,19 +225,7 @@ template <
 std::basic_ostream<CharT, Traits>& 
 operator<< (std::basic_ostream<CharT, Traits>& str, const std::tuple<Args...>& tuple_arg)
 {
-    str << tuple_utils::details::tuple_printer::lbrace;
-    
-    tuple_utils::details::tuple_printer::tuple_printer_det<
-        CharT, 
-        Traits, 
-        0, 
-        sizeof...(Args) - 1, 
-        std::tuple<Args...>
-    >::execute(str, tuple_arg);
-
-    str << tuple_utils::details::tuple_printer::rbrace;
-
-    return str;
+    return tuple_utils::details::tuple_printer::print(str, tuple_arg, std::false_type());
 }
 
 /**
@@ -165,6 +241,27 @@ operator<< (std::basic_ostream<CharT, Traits>& stream, const std::tuple<>&)
     return stream;
 }
 
+/**
+ * @brief Print any other tuple-like object (std::pair, std::array, merged_view, index_view,
+ * c_product_view,...) exactly as std::tuple with the same elements would be printed
+ * Elements are read with tuple_get, so views are printed without creating an intermediate std::tuple.
+ * Empty tuple-like object is not printed.
+ */
+template <
+        typename CharT,
+        typename Traits,
+        typename Tuple
+        >
+typename std::enable_if<tuple_utils::details::is_tuple_like<Tuple>::value, std::basic_ostream<CharT, Traits>&>::type
+operator<< (std::basic_ostream<CharT, Traits>& str, const Tuple& tuple_arg)
+{
+    return tuple_utils::details::tuple_printer::print(
+                str,
+                tuple_arg,
+                std::integral_constant<bool, std::tuple_size<Tuple>::value == 0>()
+            );
+}
+
 namespace tuple_utils
 {
 
@@ -192,6 +289,21 @@ std::string to_string(const std::tuple<>&)
     return std::string();
 }
 
+/**
+ * @brief Return std::string with the content of any other tuple-like object, equal to to_string of
+ * std::tuple with the same elements
+ */
+template <
+        typename Tuple
+        >
+typename std::enable_if<details::is_tuple_like<Tuple>::value, std::string>::type
+to_string(const Tuple& tuple)
+{
+    std::ostringstream stream;
+    stream << tuple;
+    return stream.str();
+}
+
 } //namespace tuple_utils
 
 #endif // PRINT_TUPLES_H
@@ -0,0 +1,357 @@
+#ifndef PRODUCT_RANGE_H
+#define PRODUCT_RANGE_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "aux/indexed_iterator.hpp"
+#include "aux/sequence.hpp"
+#include "zip_range.hpp"
+
+/**
+ * @file
+ * @author
+ * @version
+*/
+
+//! Utilities for tuples manipulation
+namespace tuple_utils
+{
+
+/**
+ * @brief Iterator over the Cartesian product of containers, dereference yields std::tuple of references
+ * Iterator keeps one linear index, coordinates in each container are computed from it on dereference
+ * as (index / stride) % size, so any element of the product is reached in O(1). Elements are ordered
+ * as by tuple_utils::c_product, i.e. the last container is in the innermost loop.
+ *
+ * Like zip_iterator, product_iterator is a proxy iterator with a std::tuple of references returned by
+ * value as reference, so iterator_category is std::input_iterator_tag and iterator_concept is
+ * std::random_access_iterator_tag. All random access operations take O(1). Algorithms which read
+ * elements or assign through them are supported, e.g. std::find_if, std::count_if, std::for_each,
+ * std::copy from the range. Algorithms which swap or move whole elements (std::sort, std::reverse)
+ * are not. Use end() - begin() rather than std::distance, which walks element by element.
+ * @tparam Iterators... - random access iterators of the containers
+ */
+template <
+        typename... Iterators
+        >
+class product_iterator : public details::indexed_iterator<product_iterator<Iterators...>>
+{
+public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::tuple<typename std::iterator_traits<Iterators>::value_type...>;
+    using reference = std::tuple<typename std::iterator_traits<Iterators>::reference...>;
+    using pointer = void;
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::random_access_iterator_tag;
+
+    /** Size of each container and number of elements of the product between changes of its coordinate */
+    using extents = std::array<difference_type, sizeof...(Iterators)>;
+
+    product_iterator()
+        : details::indexed_iterator<product_iterator>(0), first(), sizes(), strides()
+    { }
+
+    /**
+     * @brief Create iterator pointing to the element at given linear index of the product
+     */
+    product_iterator(std::tuple<Iterators...> first, const extents& sizes, const extents& strides,
+                     difference_type index)
+        : details::indexed_iterator<product_iterator>(index), first(first), sizes(sizes), strides(strides)
+    { }
+
+    reference operator*() const
+    {
+        return element(index_sequence_for<Iterators...>(), this->index);
+    }
+
+    reference operator[](difference_type n) const
+    {
+        return element(index_sequence_for<Iterators...>(), this->index + n);
+    }
+
+    /**
+     * @brief Linear index of the element pointed to, position in the whole product
+     */
+    difference_type position() const
+    {
+        return this->index;
+    }
+
+private:
+    template <
+            std::size_t... I
+            >
+    reference element(index_sequence<I...>, difference_type n) const
+    {
+        return reference(std::get<I>(first)[n / strides[I] % sizes[I]]...);
+    }
+
+    std::tuple<Iterators...> first;
+    extents sizes;
+    extents strides;
+};
+
+/**
+ * @brief Pair of iterators which could be used in range-based for, e.g. one chunk of product_range
+ */
+template <
+        typename Iterator
+        >
+class sub_range
+{
+public:
+    sub_range(Iterator first, Iterator last)
+        : first(first), last(last)
+    { }
+
+    Iterator begin() const
+    {
+        return first;
+    }
+
+    Iterator end() const
+    {
+        return last;
+    }
+
+    std::size_t size() const
+    {
+        return static_cast<std::size_t>(last - first);
+    }
+
+    bool empty() const
+    {
+        return first == last;
+    }
+
+private:
+    Iterator first;
+    Iterator last;
+};
+
+/**
+ * @brief Cartesian product of containers, runtime counterpart of tuple_utils::c_product_view
+ * Element at linear index k is a std::tuple of references to one element of each container, elements
+ * are ordered as by tuple_utils::c_product. Linear index is mapped to coordinates in O(1), so the product
+ * could be split with chunk() into independent parts, e.g. one for each thread of a thread pool.
+ * Lvalue containers are kept by reference and rvalue containers are moved into the range. Containers
+ * have to provide random access iterators and must not change size while the range is used.
+ * Example:
+ * @code
+ *   std::vector<int> x = {1, 2};
+ *   std::vector<double> y = {0.5, 1.5, 2.5};
+ *   auto range = tuple_utils::product_range(x, y); //6 elements: (1, 0.5), (1, 1.5), (1, 2.5), (2, 0.5),...
+ *   std::vector<std::thread> threads;
+ *   for (std::size_t i = 0; i < 4; ++i)
+ *   {
+ *       threads.emplace_back([&range, i]{ for (auto element : range.chunk(i, 4)) { sweep(element); } });
+ *   }
+ * @endcode
+ * @tparam Containers... - types of containers, lvalue references for lvalue arguments of product_range
+ */
+template <
+        typename... Containers
+        >
+class cartesian_range
+{
+public:
+    using iterator = product_iterator<typename details::container_iterator<
+        typename std::remove_reference<Containers>::type
+    >::type...>;
+    using const_iterator = product_iterator<typename details::container_iterator<
+        const typename std::remove_reference<Containers>::type
+    >::type...>;
+    using extents = typename iterator::extents;
+
+    /**
+     * @brief Create product of given containers, usually called through tuple_utils::product_range
+     */
+    explicit cartesian_range(Containers&&... containers)
+        : containers(std::forward<Containers>(containers)...)
+    { }
+
+    /**
+     * @brief Number of elements, product of sizes of all containers
+     */
+    std::size_t size() const
+    {
+        const extents s = sizes(index_sequence_for<Containers...>());
+        return static_cast<std::size_t>(s[0] * strides(s)[0]);
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Position of k-th element in each container, k should be less than size()
+     * Product with an empty container has no elements, all coordinates are zero then.
+     */
+    std::array<std::size_t, sizeof...(Containers)> coordinates(std::size_t k) const
+    {
+        const extents s = sizes(index_sequence_for<Containers...>());
+        const extents t = strides(s);
+        std::array<std::size_t, sizeof...(Containers)> result{{}};
+        if (s[0] * t[0] == 0)
+        {
+            return result;
+        }
+        for (std::size_t j = 0; j < sizeof...(Containers); ++j)
+        {
+            result[j] = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(k) / t[j] % s[j]);
+        }
+        return result;
+    }
+
+    iterator begin()
+    {
+        return begin(index_sequence_for<Containers...>());
+    }
+
+    iterator end()
+    {
+        return begin() + static_cast<std::ptrdiff_t>(size());
+    }
+
+    const_iterator begin() const
+    {
+        return begin(index_sequence_for<Containers...>());
+    }
+
+    const_iterator end() const
+    {
+        return begin() + static_cast<std::ptrdiff_t>(size());
+    }
+
+    typename iterator::reference operator[](std::size_t k)
+    {
+        return begin()[static_cast<std::ptrdiff_t>(k)];
+    }
+
+    typename const_iterator::reference operator[](std::size_t k) const
+    {
+        return begin()[static_cast<std::ptrdiff_t>(k)];
+    }
+
+    /**
+     * @brief Elements with linear indices in [first, last)
+     */
+    sub_range<iterator> slice(std::size_t first, std::size_t last)
+    {
+        return sub_range<iterator>(begin() + static_cast<std::ptrdiff_t>(first),
+                                   begin() + static_cast<std::ptrdiff_t>(last));
+    }
+
+    sub_range<const_iterator> slice(std::size_t first, std::size_t last) const
+    {
+        return sub_range<const_iterator>(begin() + static_cast<std::ptrdiff_t>(first),
+                                         begin() + static_cast<std::ptrdiff_t>(last));
+    }
+
+    /**
+     * @brief i-th of count chunks of nearly equal sizes, chunks cover the whole product without overlap
+     * The first size() % count chunks have one element more than the others.
+     * @throw std::invalid_argument if count is zero
+     * @throw std::out_of_range if i is not less than count
+     */
+    sub_range<iterator> chunk(std::size_t i, std::size_t count)
+    {
+        const std::size_t n = size();
+        return slice(chunk_begin(n, i, count), chunk_begin(n, i + 1, count));
+    }
+
+    sub_range<const_iterator> chunk(std::size_t i, std::size_t count) const
+    {
+        const std::size_t n = size();
+        return slice(chunk_begin(n, i, count), chunk_begin(n, i + 1, count));
+    }
+
+private:
+    /**
+     * @brief First linear index of i-th of count chunks of n elements, i could be equal to count
+     * Computed from the quotient and the remainder of n / count, so it does not overflow for any n.
+     */
+    static std::size_t chunk_begin(std::size_t n, std::size_t i, std::size_t count)
+    {
+        if (count == 0)
+        {
+            throw std::invalid_argument("cartesian_range: number of chunks has to be positive");
+        }
+        if (i > count)
+        {
+            throw std::out_of_range("cartesian_range: chunk index out of range");
+        }
+        return i * (n / count) + std::min(i, n % count);
+    }
+
+    template <
+            std::size_t... I
+            >
+    extents sizes(index_sequence<I...>) const
+    {
+        return extents{{static_cast<std::ptrdiff_t>(
+            std::distance(std::begin(std::get<I>(containers)), std::end(std::get<I>(containers)))
+        )...}};
+    }
+
+    /**
+     * @brief Stride of the last container is one, stride of each other one is the stride of the next
+     * container multiplied by its size
+     */
+    static extents strides(const extents& sizes)
+    {
+        extents result;
+        std::ptrdiff_t stride = 1;
+        for (std::size_t j = sizeof...(Containers); j-- > 0;)
+        {
+            result[j] = stride;
+            stride *= sizes[j];
+        }
+        return result;
+    }
+
+    template <
+            std::size_t... I
+            >
+    iterator begin(index_sequence<I...> seq)
+    {
+        const extents s = sizes(seq);
+        return iterator(std::make_tuple(std::begin(std::get<I>(containers))...), s, strides(s), 0);
+    }
+
+    template <
+            std::size_t... I
+            >
+    const_iterator begin(index_sequence<I...> seq) const
+    {
+        const extents s = sizes(seq);
+        return const_iterator(
+            std::make_tuple(details::const_begin<Containers>(std::get<I>(containers))...), s, strides(s), 0
+        );
+    }
+
+    std::tuple<Containers...> containers;
+};
+
+/**
+ * @brief Iterate over the Cartesian product of containers
+ */
+template <
+        typename First,
+        typename... Rest
+        >
+cartesian_range<First, Rest...> product_range(First&& first, Rest&&... rest)
+{
+    return cartesian_range<First, Rest...>(std::forward<First>(first), std::forward<Rest>(rest)...);
+}
+
+} //namespace tuple_utils
+
+#endif // PRODUCT_RANGE_H
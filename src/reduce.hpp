@@ -0,0 +1,352 @@
+#ifndef REDUCE_TUPLE_H
+#define REDUCE_TUPLE_H
+
+#include <tuple>
+#include <type_traits>
+#include "fold_tuples.hpp"
+#include "aux/get.hpp"
+#include "aux/sequence.hpp"
+#include "aux/traits.hpp"
+
+/**
+ * @file
+ * @author
+ * @version
+*/
+
+//! Utilities for tuples manipulation
+namespace tuple_utils
+{
+
+///@internal
+namespace details
+{
+
+/**
+ * @brief Transformation used by tuple_utils::reduce, passes each element on with its value category
+ */
+struct forward_element
+{
+    template <
+            typename T
+            >
+    constexpr T&& operator()(T&& x) const noexcept
+    {
+        return static_cast<T&&>(x);
+    }
+};
+
+/**
+ * @brief Type of the operand made of element I of Tuple, as returned by transformation g
+ */
+template <
+        std::size_t I,
+        typename Transform,
+        typename Tuple
+        >
+struct reduce_operand
+{
+    using type = typename call_result<Transform, typename tuple_get_type<I, Tuple>::type>::type;
+};
+
+/**
+ * @brief Type returned by reduce of operands Args... in given Order, types are shared with tuple_utils::fold
+ */
+template <
+        typename Order,
+        typename FuncType,
+        typename... Args
+        >
+struct reduce_result
+{
+    using type = typename Order::template result<FuncType, Args...>::type;
+};
+
+/**
+ * @brief Single operand is not combined with anything, so it is returned without calling f
+ */
+template <
+        typename Order,
+        typename FuncType,
+        typename X
+        >
+struct reduce_result<Order, FuncType, X>
+{
+    using type = typename std::decay<X>::type;
+};
+
+/**
+ * @brief Empty tuple reduced without initial value
+ */
+template <
+        typename Order,
+        typename FuncType
+        >
+struct reduce_result<Order, FuncType>
+{
+    static_assert(sizeof(FuncType) == 0, "Can not reduce empty tuple without initial value");
+};
+
+//Forward declaration
+template <
+        typename Seq,
+        typename Order,
+        typename FuncType,
+        typename Transform,
+        typename Tuple,
+        typename... Init
+        >
+struct reduce_result_type_det;
+
+/**
+ * @brief Determine type returned by tuple_utils::reduce and tuple_utils::transform_reduce
+ * Initial value, if given, is the first operand, then the transformed elements follow in order.
+ */
+template <
+        std::size_t... I,
+        typename Order,
+        typename FuncType,
+        typename Transform,
+        typename Tuple,
+        typename... Init
+        >
+struct reduce_result_type_det<index_sequence<I...>, Order, FuncType, Transform, Tuple, Init...>
+{
+    static_assert(sizeof...(Init) < 2, "Only one initial value could be given");
+    using type = typename reduce_result<
+        Order,
+        FuncType,
+        Init...,
+        typename reduce_operand<I, Transform, Tuple>::type...
+    >::type;
+};
+
+/**
+ * @brief Type returned by reduce of Tuple, see reduce_result_type_det
+ */
+template <
+        typename Order,
+        typename FuncType,
+        typename Transform,
+        typename Tuple,
+        typename... Init
+        >
+struct reduce_result_type :
+        reduce_result_type_det<make_index_sequence<size_bare<Tuple>::value>, Order, FuncType, Transform, Tuple, Init...>
+{ };
+
+/**
+ * @brief Single operand is returned as it is (copied or moved)
+ */
+template <
+        typename Order,
+        typename FuncType,
+        typename X
+        >
+TUTILS_CONSTEXPR14 typename std::decay<X>::type reduce_operands(FuncType&, X&& onlyOne)
+{
+    return std::forward<X>(onlyOne);
+}
+
+/**
+ * @brief More operands are folded in given Order, with the same machinery as tuple_utils::fold uses for one column
+ */
+template <
+        typename Order,
+        typename FuncType,
+        typename X,
+        typename Y,
+        typename... R
+        >
+TUTILS_CONSTEXPR14 typename reduce_result<Order, FuncType, X, Y, R...>::type
+reduce_operands(FuncType& f, X&& x, Y&& y, R&&... rest)
+{
+    return Order::invoke(f, std::forward<X>(x), std::forward<Y>(y), std::forward<R>(rest)...);
+}
+
+/**
+ * @brief Helper function used by tuple_utils::reduce and tuple_utils::transform_reduce
+ * All elements are transformed and passed to the reduction at once, so the reduction is fully unrolled.
+ * Each element is read once, so elements of rvalue tuples are moved into g (and into f by tuple_utils::reduce).
+ * Neither f nor g is copied, both are called through references to the objects given by the caller.
+ */
+template <
+        typename Order,
+        std::size_t... I,
+        typename FuncType,
+        typename Transform,
+        typename Tuple,
+        typename... Init
+        >
+TUTILS_CONSTEXPR14 auto reduce_det(index_sequence<I...>, FuncType& f, Transform&& g, Tuple&& tuple, Init&&... init)
+-> typename reduce_result_type<Order, FuncType, Transform, Tuple, Init...>::type
+{
+    //g is not called for an empty tuple
+    (void)g;
+    return reduce_operands<Order>(
+                f,
+                std::forward<Init>(init)...,
+                call_forwarding(g, tuple_get<I>(std::forward<Tuple>(tuple)))...
+            );
+}
+
+} //namespace details
+///@endinternal
+
+/**
+ * @brief Reduce elements of one tuple to one value, f(x0, f(x1, f(x2,... xN)))
+ * Elements are folded as one column of tuple_utils::fold, so f could be a function template (or a generic
+ * functor) accepting each pair of types it meets, and the result type is given by tuple_utils::result_of_rec.
+ * Optional initial value is folded as the first operand, f(init, f(x0,... xN)), so an empty tuple could be
+ * reduced too. Tuple with one element and no initial value gives that element without calling f.
+ * The reduction is fully unrolled, and when compiled as C++14 or later it could be evaluated at compile
+ * time if f is constexpr.
+ * @param f - binary function
+ * @param tuple - std::tuple, std::pair, std::array or any other tuple-like type
+ * @param init - at most one initial value
+ *
+ *  Example Usage:
+ *  @code
+ *    auto sum = tuple_utils::reduce(std::plus<>(), std::make_tuple(1, 2L, 3.5)); //std::plus<>() from C++14
+ *    // sum is equal to double{6.5}, 1 + (2L + 3.5)
+ *    auto text = tuple_utils::reduce(std::plus<>(), std::make_tuple(std::string("a"), "b"), std::string(">"));
+ *    // text is equal to std::string(">ab"), std::string(">") + (std::string("a") + "b")
+ * @endcode
+ */
+template <
+        typename FuncType,
+        typename Tuple,
+        typename... Init
+        >
+TUTILS_CONSTEXPR14 auto reduce(FuncType&& f, Tuple&& tuple, Init&&... init)
+-> typename details::reduce_result_type<details::fold_right_order, FuncType, details::forward_element, Tuple, Init...>::type
+{
+    return details::reduce_det<details::fold_right_order>(
+                make_index_sequence<size_bare<Tuple>::value>(),
+                f,
+                details::forward_element(),
+                std::forward<Tuple>(tuple),
+                std::forward<Init>(init)...
+            );
+}
+
+/**
+ * @brief Reduce elements of one tuple from the left, f(f(f(x0, x1), x2),... xN), as tuple_utils::fold_left
+ * Optional initial value is folded first, f(f(init, x0),... xN). The result type is given by
+ * tuple_utils::result_of_left.
+ */
+template <
+        typename FuncType,
+        typename Tuple,
+        typename... Init
+        >
+TUTILS_CONSTEXPR14 auto reduce_left(FuncType&& f, Tuple&& tuple, Init&&... init)
+-> typename details::reduce_result_type<details::fold_left_order, FuncType, details::forward_element, Tuple, Init...>::type
+{
+    return details::reduce_det<details::fold_left_order>(
+                make_index_sequence<size_bare<Tuple>::value>(),
+                f,
+                details::forward_element(),
+                std::forward<Tuple>(tuple),
+                std::forward<Init>(init)...
+            );
+}
+
+/**
+ * @brief Reduce elements of one tuple as a balanced tree, e.g. f(f(x0, x1), f(x2, x3)), as tuple_utils::fold_tree
+ * Chain of dependent calls has logarithmic length, intended for associative functions such as sums of
+ * arithmetic values or combining hashes. Optional initial value is folded as the first operand.
+ * The result type is given by tuple_utils::result_of_tree.
+ */
+template <
+        typename FuncType,
+        typename Tuple,
+        typename... Init
+        >
+TUTILS_CONSTEXPR14 auto reduce_tree(FuncType&& f, Tuple&& tuple, Init&&... init)
+-> typename details::reduce_result_type<details::fold_tree_order, FuncType, details::forward_element, Tuple, Init...>::type
+{
+    return details::reduce_det<details::fold_tree_order>(
+                make_index_sequence<size_bare<Tuple>::value>(),
+                f,
+                details::forward_element(),
+                std::forward<Tuple>(tuple),
+                std::forward<Init>(init)...
+            );
+}
+
+/**
+ * @brief Transform each element of one tuple with g and reduce the results with f, as tuple_utils::reduce
+ * For elements x0,..., xN the result is f(g(x0), f(g(x1),... g(xN))). Results of g are passed to f as they
+ * are returned, prvalues as rvalues. Order of calls of g is unspecified, so g should not depend on it.
+ * Initial value is not transformed.
+ *
+ *  Example Usage:
+ *  @code
+ *    auto hash = tuple_utils::transform_reduce(combine_hashes(), hash_any(), std::make_tuple(1, std::string("a")));
+ *    // hash is equal to combine_hashes()(hash_any()(1), hash_any()(std::string("a")))
+ * @endcode
+ */
+template <
+        typename FuncType,
+        typename Transform,
+        typename Tuple,
+        typename... Init
+        >
+TUTILS_CONSTEXPR14 auto transform_reduce(FuncType&& f, Transform&& g, Tuple&& tuple, Init&&... init)
+-> typename details::reduce_result_type<details::fold_right_order, FuncType, Transform, Tuple, Init...>::type
+{
+    return details::reduce_det<details::fold_right_order>(
+                make_index_sequence<size_bare<Tuple>::value>(),
+                f,
+                g,
+                std::forward<Tuple>(tuple),
+                std::forward<Init>(init)...
+            );
+}
+
+/**
+ * @brief Transform each element of one tuple with g and reduce the results from the left, as tuple_utils::reduce_left
+ */
+template <
+        typename FuncType,
+        typename Transform,
+        typename Tuple,
+        typename... Init
+        >
+TUTILS_CONSTEXPR14 auto transform_reduce_left(FuncType&& f, Transform&& g, Tuple&& tuple, Init&&... init)
+-> typename details::reduce_result_type<details::fold_left_order, FuncType, Transform, Tuple, Init...>::type
+{
+    return details::reduce_det<details::fold_left_order>(
+                make_index_sequence<size_bare<Tuple>::value>(),
+                f,
+                g,
+                std::forward<Tuple>(tuple),
+                std::forward<Init>(init)...
+            );
+}
+
+/**
+ * @brief Transform each element of one tuple with g and reduce the results as a balanced tree, as tuple_utils::reduce_tree
+ */
+template <
+        typename FuncType,
+        typename Transform,
+        typename Tuple,
+        typename... Init
+        >
+TUTILS_CONSTEXPR14 auto transform_reduce_tree(FuncType&& f, Transform&& g, Tuple&& tuple, Init&&... init)
+-> typename details::reduce_result_type<details::fold_tree_order, FuncType, Transform, Tuple, Init...>::type
+{
+    return details::reduce_det<details::fold_tree_order>(
+                make_index_sequence<size_bare<Tuple>::value>(),
+                f,
+                g,
+                std::forward<Tuple>(tuple),
+                std::forward<Init>(init)...
+            );
+}
+
+} //namespace tuple_utils
+
+#endif // REDUCE_TUPLE_H
@@ -4,6 +4,7 @@
 #include <tuple>
 #include <type_traits>
 #include "aux/sequence.hpp"
+#include "aux/sequence_algebra.hpp"
 #include "aux/traits.hpp"
 
 /**
@@ -25,13 +26,13 @@ namespace details
  * Using given reverse sequence and variadic pack expansion create new std::tuple with elements in
  * reverse order comparing to the orginal tuple passed to tuple_utils::reverse.
  * @tparam Tuple - type of std::tuple passed to tuple_utils::reverse as an argument
- * @tparam RevSqe... - sequence N-1, N-2, N-3,..., 0 where N is equal to std::tuple_size<Tuple>::value
+ * @tparam RevSeq... - sequence N-1, N-2, N-3,..., 0 where N is equal to std::tuple_size<Tuple>::value
  */
 template <
         typename Tuple,
-        int... RevSeq
+        std::size_t... RevSeq
         >
-auto reverse_det(Tuple&& tuple, sequence<RevSeq...>)
+auto reverse_det(Tuple&& tuple, index_sequence<RevSeq...>)
 -> decltype(std::make_tuple(std::get<RevSeq>(std::forward<Tuple>(tuple))...))
 {
     return std::make_tuple(std::get<RevSeq>(std::forward<Tuple>(tuple))...);
@@ -57,12 +58,12 @@ template <
 auto reverse(Tuple&& tuple)
 -> decltype(details::reverse_det(
                 std::forward<Tuple>(tuple),
-                typename make_sequence<-1, size_bare<Tuple>::value - 1, -1>::type()
+                typename sequence_reverse<make_index_sequence<size_bare<Tuple>::value>>::type()
             ))
 {
     return details::reverse_det(
                     std::forward<Tuple>(tuple),
-                    typename make_sequence<-1, size_bare<Tuple>::value - 1, -1>::type()
+                    typename sequence_reverse<make_index_sequence<size_bare<Tuple>::value>>::type()
                 );
 }
 
@@ -0,0 +1,525 @@
+#ifndef SOA_VECTOR_H
+#define SOA_VECTOR_H
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "aux/aligned_allocator.hpp"
+#include "aux/get.hpp"
+#include "aux/sequence.hpp"
+#include "aux/traits.hpp"
+#include "zip_range.hpp"
+
+/**
+ * @file
+ * @author
+ * @version
+*/
+
+//! Utilities for tuples manipulation
+namespace tuple_utils
+{
+
+/**
+ * @brief Non-owning view of contiguous elements, used for columns of soa_vector
+ * @tparam T - type of elements, const qualified for read-only columns
+ */
+template <
+        typename T
+        >
+class column_span
+{
+public:
+    using value_type = typename std::remove_const<T>::type;
+    using iterator = T*;
+
+    column_span(T* data, std::size_t size)
+        : first(data), count(size)
+    { }
+
+    T* data() const
+    {
+        return first;
+    }
+
+    std::size_t size() const
+    {
+        return count;
+    }
+
+    bool empty() const
+    {
+        return count == 0;
+    }
+
+    T* begin() const
+    {
+        return first;
+    }
+
+    T* end() const
+    {
+        return first + count;
+    }
+
+    T& operator[](std::size_t i) const
+    {
+        return first[i];
+    }
+
+private:
+    T* first;
+    std::size_t count;
+};
+
+///@internal
+namespace details
+{
+
+/**
+ * @brief Check if any of Ts... is bool, columns are std::vectors and std::vector<bool> has no data()
+ * Checked without recursion, as no column is bool only if all of them are not.
+ */
+template <
+        typename... Ts
+        >
+struct has_bool_column :
+        std::integral_constant<
+            bool,
+            !all_of<!std::is_same<typename std::remove_cv<Ts>::type, bool>::value...>::value
+        >
+{ };
+
+} //namespace details
+///@endinternal
+
+/**
+ * @brief Container of rows with elements of types Ts..., each element of a row is kept in its own array
+ * (struct of arrays). Every column is a contiguous array aligned to the beginning of a cache line, so
+ * loops over one or a few columns read only the memory they use and could be vectorized.
+ * Rows are std::tuples of references to elements in columns, so they could be passed to
+ * tuple_utils::explode, tuple_utils::fold, tuple_utils::zip or compared with std::tuples.
+ * Iteration is done with zip_iterator over column arrays, i.e. with one index shared by all columns.
+ * Columns of bool are not supported, as std::vector<bool> keeps bits and gives no bool* to its elements,
+ * flags could be kept in a char or std::uint8_t column instead.
+ * Example:
+ * @code
+ *   tuple_utils::soa_vector<int, double> values;
+ *   values.push_back(std::make_tuple(1, 0.5));
+ *   values.emplace_back(2, 1.5);
+ *   for (auto row : values)
+ *   {
+ *       std::get<1>(row) *= std::get<0>(row); //values are equal to ((1, 0.5), (2, 3.0))
+ *   }
+ *   double sum = 0;
+ *   for (double x : values.column<1>()) //reads only the second column
+ *   {
+ *       sum += x;
+ *   }
+ * @endcode
+ */
+template <
+        typename... Ts
+        >
+class soa_vector
+{
+public:
+    static_assert(sizeof...(Ts) > 0, "At least one column is required");
+    static_assert(!details::has_bool_column<Ts...>::value,
+                  "bool columns are not supported, std::vector<bool> is packed, use char or std::uint8_t");
+
+    using value_type = std::tuple<Ts...>;
+    using reference = std::tuple<Ts&...>;
+    using const_reference = std::tuple<const Ts&...>;
+    using iterator = zip_iterator<Ts*...>;
+    using const_iterator = zip_iterator<const Ts*...>;
+
+    soa_vector() = default;
+
+    /**
+     * @brief Create soa_vector with copies of given rows, as tuple_utils::unzip does for std::vectors
+     */
+    explicit soa_vector(const std::vector<value_type>& rows)
+    {
+        append(rows);
+    }
+
+    explicit soa_vector(std::vector<value_type>&& rows)
+    {
+        append(std::move(rows));
+    }
+
+    std::size_t size() const
+    {
+        return std::get<0>(columns).size();
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Number of rows which fit into all columns without reallocation
+     */
+    std::size_t capacity() const
+    {
+        return capacity(index_sequence_for<Ts...>());
+    }
+
+    /**
+     * @brief Reserve space for n rows in all columns
+     */
+    void reserve(std::size_t n)
+    {
+        each_column(index_sequence_for<Ts...>(), reserve_column{n});
+    }
+
+    void clear()
+    {
+        each_column(index_sequence_for<Ts...>(), clear_column());
+    }
+
+    void pop_back()
+    {
+        each_column(index_sequence_for<Ts...>(), pop_column());
+    }
+
+    /**
+     * @brief Append row with elements taken from std::tuple (or any other tuple-like type)
+     * Elements of rvalue tuples are moved. If constructing any element throws, no row is added.
+     */
+    template <
+            typename Tuple
+            >
+    void push_back(Tuple&& row)
+    {
+        static_assert(size_bare<Tuple>::value == sizeof...(Ts),
+                      "Row has to have one element for each column");
+        append_row(index_sequence_for<Ts...>(), std::forward<Tuple>(row));
+    }
+
+    /**
+     * @brief Append row with element I constructed from args[I]
+     */
+    template <
+            typename... Args
+            >
+    void emplace_back(Args&&... args)
+    {
+        static_assert(sizeof...(Args) == sizeof...(Ts), "One argument for each column is required");
+        append_row(index_sequence_for<Ts...>(), std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Append rows from std::vector of std::tuples, each column grows only once
+     */
+    void append(const std::vector<value_type>& rows)
+    {
+        append_rows(index_sequence_for<Ts...>(), rows);
+    }
+
+    void append(std::vector<value_type>&& rows)
+    {
+        append_rows(index_sequence_for<Ts...>(), std::move(rows));
+    }
+
+    /**
+     * @brief Row at index i, std::tuple of references to its elements
+     */
+    reference operator[](std::size_t i)
+    {
+        return begin()[static_cast<std::ptrdiff_t>(i)];
+    }
+
+    const_reference operator[](std::size_t i) const
+    {
+        return begin()[static_cast<std::ptrdiff_t>(i)];
+    }
+
+    reference front()
+    {
+        return *begin();
+    }
+
+    const_reference front() const
+    {
+        return *begin();
+    }
+
+    reference back()
+    {
+        return (*this)[size() - 1];
+    }
+
+    const_reference back() const
+    {
+        return (*this)[size() - 1];
+    }
+
+    iterator begin()
+    {
+        return iterator(datas(index_sequence_for<Ts...>()), 0);
+    }
+
+    iterator end()
+    {
+        return begin() + static_cast<std::ptrdiff_t>(size());
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(datas(index_sequence_for<Ts...>()), 0);
+    }
+
+    const_iterator end() const
+    {
+        return begin() + static_cast<std::ptrdiff_t>(size());
+    }
+
+    /**
+     * @brief Contiguous elements of column I
+     */
+    template <
+            std::size_t I
+            >
+    column_span<typename std::tuple_element<I, value_type>::type> column()
+    {
+        return column_span<typename std::tuple_element<I, value_type>::type>(
+                    std::get<I>(columns).data(),
+                    size()
+                );
+    }
+
+    template <
+            std::size_t I
+            >
+    column_span<const typename std::tuple_element<I, value_type>::type> column() const
+    {
+        return column_span<const typename std::tuple_element<I, value_type>::type>(
+                    std::get<I>(columns).data(),
+                    size()
+                );
+    }
+
+    /**
+     * @brief All columns at once, std::tuple of column_spans
+     */
+    std::tuple<column_span<Ts>...> all_columns()
+    {
+        return spans(index_sequence_for<Ts...>());
+    }
+
+    std::tuple<column_span<const Ts>...> all_columns() const
+    {
+        return spans(index_sequence_for<Ts...>());
+    }
+
+    /**
+     * @brief Copy all rows to std::vector of std::tuples, inverse of the constructor
+     */
+    std::vector<value_type> rows() const
+    {
+        std::vector<value_type> result;
+        result.reserve(size());
+        for (const_reference row : *this)
+        {
+            result.emplace_back(row);
+        }
+        return result;
+    }
+
+private:
+    struct clear_column
+    {
+        template <
+                typename Column
+                >
+        void operator()(Column& column) const
+        {
+            column.clear();
+        }
+    };
+
+    struct reserve_column
+    {
+        template <
+                typename Column
+                >
+        void operator()(Column& column) const
+        {
+            column.reserve(n);
+        }
+
+        std::size_t n;
+    };
+
+    /**
+     * @brief Remove elements above size n, used to roll back a partially added row
+     */
+    struct truncate_column
+    {
+        template <
+                typename Column
+                >
+        void operator()(Column& column) const
+        {
+            while (column.size() > n)
+            {
+                column.pop_back();
+            }
+        }
+
+        std::size_t n;
+    };
+
+    struct pop_column
+    {
+        template <
+                typename Column
+                >
+        void operator()(Column& column) const
+        {
+            column.pop_back();
+        }
+    };
+
+    template <
+            std::size_t... I,
+            typename Func
+            >
+    void each_column(index_sequence<I...>, Func func)
+    {
+        details::expand{(func(std::get<I>(columns)), 0)...};
+    }
+
+    template <
+            std::size_t... I
+            >
+    std::size_t capacity(index_sequence<I...>) const
+    {
+        const std::size_t capacities[] = {std::get<I>(columns).capacity()...};
+        return details::min_value(capacities, 0, sizeof...(I));
+    }
+
+    /**
+     * @brief Make sure that given number of rows fits into all columns, so element constructors are
+     * the only operations which could throw while rows are appended
+     */
+    void grow_for(std::size_t rows)
+    {
+        if (size() + rows > capacity())
+        {
+            const std::size_t doubled = 2 * capacity();
+            reserve(doubled > size() + rows ? doubled : size() + rows);
+        }
+    }
+
+    template <
+            std::size_t... I,
+            typename Tuple
+            >
+    void append_row(index_sequence<I...> seq, Tuple&& row)
+    {
+        if (size() + 1 > capacity())
+        {
+            //row could refer to elements of this soa_vector, so it is read before columns are reallocated
+            value_type local(details::tuple_get<I>(std::forward<Tuple>(row))...);
+            grow_for(1);
+            append_reserved_row(seq, std::move(local));
+        }
+        else
+        {
+            append_reserved_row(seq, std::forward<Tuple>(row));
+        }
+    }
+
+    /**
+     * @brief Append row into columns which have space for it
+     */
+    template <
+            std::size_t... I,
+            typename Tuple
+            >
+    void append_reserved_row(index_sequence<I...> seq, Tuple&& row)
+    {
+        const std::size_t old = size();
+        try
+        {
+            details::expand{
+                (std::get<I>(columns).emplace_back(details::tuple_get<I>(std::forward<Tuple>(row))), 0)...
+            };
+        }
+        catch (...)
+        {
+            each_column(seq, truncate_column{old});
+            throw;
+        }
+    }
+
+    template <
+            std::size_t... I,
+            typename Rows
+            >
+    void append_rows(index_sequence<I...> seq, Rows&& rows)
+    {
+        grow_for(rows.size());
+        const std::size_t old = size();
+        try
+        {
+            for (auto& row : rows)
+            {
+                details::expand{
+                    (std::get<I>(columns).emplace_back(details::forward_like<Rows>(std::get<I>(row))), 0)...
+                };
+            }
+        }
+        catch (...)
+        {
+            each_column(seq, truncate_column{old});
+            throw;
+        }
+    }
+
+    template <
+            std::size_t... I
+            >
+    std::tuple<Ts*...> datas(index_sequence<I...>)
+    {
+        return std::tuple<Ts*...>(std::get<I>(columns).data()...);
+    }
+
+    template <
+            std::size_t... I
+            >
+    std::tuple<const Ts*...> datas(index_sequence<I...>) const
+    {
+        return std::tuple<const Ts*...>(std::get<I>(columns).data()...);
+    }
+
+    template <
+            std::size_t... I
+            >
+    std::tuple<column_span<Ts>...> spans(index_sequence<I...>)
+    {
+        return std::tuple<column_span<Ts>...>(column_span<Ts>(std::get<I>(columns).data(), size())...);
+    }
+
+    template <
+            std::size_t... I
+            >
+    std::tuple<column_span<const Ts>...> spans(index_sequence<I...>) const
+    {
+        return std::tuple<column_span<const Ts>...>(
+                    column_span<const Ts>(std::get<I>(columns).data(), size())...
+                );
+    }
+
+    std::tuple<std::vector<Ts, aligned_allocator<Ts>>...> columns;
+};
+
+} //namespace tuple_utils
+
+#endif // SOA_VECTOR_H
@@ -0,0 +1,217 @@
+#ifndef UNZIP_H
+#define UNZIP_H
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "aux/get.hpp"
+#include "aux/sequence.hpp"
+#include "aux/sequence_algebra.hpp"
+#include "aux/traits.hpp"
+
+/**
+ * @file
+ * @author
+ * @version
+*/
+
+//! Utilities for tuples manipulation
+namespace tuple_utils
+{
+
+///@internal
+namespace details
+{
+
+/**
+ * @brief Copy elements of rows into columns, fast path for trivial element types
+ * Columns are resized once, then every row is read once and its elements are stored with assignments.
+ * @tparam Rows - lvalue or rvalue reference to std::vector<std::tuple<T...>>
+ */
+template <
+        typename... T,
+        std::size_t... I,
+        typename Rows
+        >
+void unzip_det(std::true_type, index_sequence<I...>, Rows&& rows, std::tuple<std::vector<T>...>& columns)
+{
+    const std::size_t size = rows.size();
+    expand{(std::get<I>(columns).resize(size), 0)...};
+    for (std::size_t r = 0; r < size; ++r)
+    {
+        expand{(std::get<I>(columns)[r] = std::get<I>(rows[r]), 0)...};
+    }
+}
+
+/**
+ * @brief Copy or move elements of rows into columns, elements are constructed in place in reserved columns
+ * Elements of rvalue rows are moved.
+ */
+template <
+        typename... T,
+        std::size_t... I,
+        typename Rows
+        >
+void unzip_det(std::false_type, index_sequence<I...>, Rows&& rows, std::tuple<std::vector<T>...>& columns)
+{
+    const std::size_t size = rows.size();
+    expand{(std::get<I>(columns).reserve(size), 0)...};
+    for (std::size_t r = 0; r < size; ++r)
+    {
+        expand{(std::get<I>(columns).emplace_back(forward_like<Rows>(std::get<I>(rows[r]))), 0)...};
+    }
+}
+
+/**
+ * @brief Create rows from columns, fast path for trivial element types
+ * Result is resized once and filled with plain assignments, columns are read in one pass.
+ */
+template <
+        typename... T,
+        std::size_t... I,
+        typename Columns
+        >
+void zip_columns_det(std::true_type, index_sequence<I...>, Columns&& columns, std::size_t size,
+                     std::vector<std::tuple<T...>>& rows)
+{
+    rows.resize(size);
+    for (std::size_t r = 0; r < size; ++r)
+    {
+        expand{(std::get<I>(rows[r]) = std::get<I>(columns)[r], 0)...};
+    }
+}
+
+/**
+ * @brief Create rows from columns, each row is constructed in place in the reserved result
+ * Elements of rvalue columns are moved.
+ */
+template <
+        typename... T,
+        std::size_t... I,
+        typename Columns
+        >
+void zip_columns_det(std::false_type, index_sequence<I...>, Columns&& columns, std::size_t size,
+                     std::vector<std::tuple<T...>>& rows)
+{
+    rows.reserve(size);
+    for (std::size_t r = 0; r < size; ++r)
+    {
+        rows.emplace_back(forward_like<Columns>(std::get<I>(columns)[r])...);
+    }
+}
+
+/**
+ * @brief Number of rows which could be created from columns, size of the smallest column
+ */
+template <
+        typename Columns,
+        std::size_t... I
+        >
+std::size_t columns_size(const Columns& columns, index_sequence<I...>)
+{
+    static_assert(sizeof...(I) > 0, "At least one column is required");
+    const std::size_t sizes[] = {std::get<I>(columns).size()...};
+    return min_value(sizes, 0, sizeof...(I));
+}
+
+} //namespace details
+///@endinternal
+
+/**
+ * @brief Convert rows to columns, std::vector of std::tuples to std::tuple of std::vectors (AoS to SoA)
+ * Every column is allocated once with the final size. For trivial element types columns are resized
+ * and filled with assignments in one pass over rows, otherwise elements are constructed in place.
+ * Elements of rvalue vectors are moved.
+ * Example:
+ * @code
+ *   std::vector<std::tuple<int, double>> rows = {std::make_tuple(1, 0.5), std::make_tuple(2, 1.5)};
+ *   auto columns = tuple_utils::unzip(rows);
+ *   //columns is equal to std::tuple<std::vector<int>, std::vector<double>>
+ *   //and contain values ({1, 2}, {0.5, 1.5})
+ * @endcode
+ */
+template <
+        typename... T
+        >
+std::tuple<std::vector<T>...> unzip(const std::vector<std::tuple<T...>>& rows)
+{
+    std::tuple<std::vector<T>...> columns;
+    details::unzip_det(
+                details::all_of<std::is_trivial<T>::value...>(),
+                index_sequence_for<T...>(),
+                rows,
+                columns
+            );
+    return columns;
+}
+
+/**
+ * @brief Convert rvalue rows to columns, elements are moved
+ */
+template <
+        typename... T
+        >
+std::tuple<std::vector<T>...> unzip(std::vector<std::tuple<T...>>&& rows)
+{
+    std::tuple<std::vector<T>...> columns;
+    details::unzip_det(
+                details::all_of<std::is_trivial<T>::value...>(),
+                index_sequence_for<T...>(),
+                std::move(rows),
+                columns
+            );
+    return columns;
+}
+
+/**
+ * @brief Convert columns to rows, std::tuple of std::vectors to std::vector of std::tuples (SoA to AoS)
+ * Inverse of tuple_utils::unzip. As for tuple_utils::zip the number of rows is equal to the size of the
+ * smallest column. The result is allocated once, elements of rvalue columns are moved.
+ * Example:
+ * @code
+ *   auto columns = std::make_tuple(std::vector<int>{1, 2, 3}, std::vector<char>{'a', 'b'});
+ *   auto rows = tuple_utils::zip_columns(columns);
+ *   //rows is equal to std::vector<std::tuple<int, char>> and contain values ((1, 'a'), (2, 'b'))
+ * @endcode
+ */
+template <
+        typename... T
+        >
+std::vector<std::tuple<T...>> zip_columns(const std::tuple<std::vector<T>...>& columns)
+{
+    std::vector<std::tuple<T...>> rows;
+    details::zip_columns_det(
+                details::all_of<std::is_trivial<T>::value...>(),
+                index_sequence_for<T...>(),
+                columns,
+                details::columns_size(columns, index_sequence_for<T...>()),
+                rows
+            );
+    return rows;
+}
+
+/**
+ * @brief Convert rvalue columns to rows, elements are moved
+ */
+template <
+        typename... T
+        >
+std::vector<std::tuple<T...>> zip_columns(std::tuple<std::vector<T>...>&& columns)
+{
+    std::vector<std::tuple<T...>> rows;
+    const std::size_t size = details::columns_size(columns, index_sequence_for<T...>());
+    details::zip_columns_det(
+                details::all_of<std::is_trivial<T>::value...>(),
+                index_sequence_for<T...>(),
+                std::move(columns),
+                size,
+                rows
+            );
+    return rows;
+}
+
+} //namespace tuple_utils
+
+#endif // UNZIP_H
@@ -0,0 +1,241 @@
+#ifndef ZIP_RANGE_H
+#define ZIP_RANGE_H
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "aux/indexed_iterator.hpp"
+#include "aux/sequence.hpp"
+#include "aux/traits.hpp"
+
+/**
+ * @file
+ * @author
+ * @version
+*/
+
+//! Utilities for tuples manipulation
+namespace tuple_utils
+{
+
+/**
+ * @brief Iterator over rows of parallel containers, dereference yields std::tuple of references
+ * Keeps iterators to the beginnings of all containers and one common index, so advancing or comparing
+ * iterators touches only the index (see details::indexed_iterator). A loop over zip_iterators is
+ * therefore the same as a hand-written indexed loop and could be vectorized by the compiler.
+ *
+ * zip_iterator is a proxy iterator: reference is a std::tuple of references returned by value, not
+ * value_type&, so iterator_category is std::input_iterator_tag (iterator_concept is
+ * std::random_access_iterator_tag, as for C++20 views::zip). All random access operations are provided
+ * and take O(1). Algorithms which read rows or assign through their elements are supported, e.g.
+ * std::find_if, std::count_if, std::for_each, std::copy from the range. Algorithms which swap or move
+ * whole rows (std::sort, std::reverse, std::iter_swap) are not. std::distance walks row by row,
+ * end() - begin() gives the same value in O(1).
+ * @tparam Iterators... - random access iterators of the zipped containers
+ */
+template <
+        typename... Iterators
+        >
+class zip_iterator : public details::indexed_iterator<zip_iterator<Iterators...>>
+{
+public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::tuple<typename std::iterator_traits<Iterators>::value_type...>;
+    using reference = std::tuple<typename std::iterator_traits<Iterators>::reference...>;
+    using pointer = void;
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::random_access_iterator_tag;
+
+    zip_iterator()
+        : details::indexed_iterator<zip_iterator>(0), first()
+    { }
+
+    /**
+     * @brief Create iterator pointing to the row at given index of containers starting at given iterators
+     */
+    zip_iterator(std::tuple<Iterators...> first, difference_type index)
+        : details::indexed_iterator<zip_iterator>(index), first(first)
+    { }
+
+    reference operator*() const
+    {
+        return row(index_sequence_for<Iterators...>(), this->index);
+    }
+
+    reference operator[](difference_type n) const
+    {
+        return row(index_sequence_for<Iterators...>(), this->index + n);
+    }
+
+private:
+    template <
+            std::size_t... I
+            >
+    reference row(index_sequence<I...>, difference_type n) const
+    {
+        return reference(std::get<I>(first)[n]...);
+    }
+
+    std::tuple<Iterators...> first;
+};
+
+///@internal
+namespace details
+{
+
+/**
+ * @brief Type of iterator of Container, Container could be const qualified
+ */
+template <
+        typename Container
+        >
+struct container_iterator
+{
+    using type = decltype(std::begin(std::declval<Container&>()));
+};
+
+/**
+ * @brief Iterator to the beginning of a container kept by a range, as a const iterator
+ * Containers kept by lvalue reference are not const in the const tuple, so constness is added here.
+ * @tparam Container - type of the kept container, lvalue reference or non-reference type
+ */
+template <
+        typename Container
+        >
+auto const_begin(const typename std::remove_reference<Container>::type& container)
+-> typename container_iterator<const typename std::remove_reference<Container>::type>::type
+{
+    return std::begin(container);
+}
+
+} //namespace details
+///@endinternal
+
+/**
+ * @brief Range of rows of parallel containers, runtime counterpart of tuple_utils::zip_ref
+ * Row at index i is a std::tuple of references to the i-th elements of all containers. As for
+ * tuple_utils::zip the number of rows is equal to the size of the smallest container. Lvalue containers
+ * are kept by reference and rvalue containers are moved into the range, so the range could be returned
+ * from a function. Containers have to provide random access iterators (std::vector, std::array,
+ * std::deque, built-in arrays).
+ * @tparam Containers... - types of zipped containers, lvalue references for lvalue arguments of zip_range
+ */
+template <
+        typename... Containers
+        >
+class zipped_range
+{
+public:
+    using iterator = zip_iterator<typename details::container_iterator<
+        typename std::remove_reference<Containers>::type
+    >::type...>;
+    using const_iterator = zip_iterator<typename details::container_iterator<
+        const typename std::remove_reference<Containers>::type
+    >::type...>;
+
+    /**
+     * @brief Create range of given containers, usually called through tuple_utils::zip_range
+     */
+    explicit zipped_range(Containers&&... containers)
+        : containers(std::forward<Containers>(containers)...)
+    { }
+
+    /**
+     * @brief Number of rows, equal to the size of the smallest container
+     */
+    std::size_t size() const
+    {
+        return size(index_sequence_for<Containers...>());
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    iterator begin()
+    {
+        return begin(index_sequence_for<Containers...>());
+    }
+
+    iterator end()
+    {
+        return begin() + static_cast<std::ptrdiff_t>(size());
+    }
+
+    const_iterator begin() const
+    {
+        return begin(index_sequence_for<Containers...>());
+    }
+
+    const_iterator end() const
+    {
+        return begin() + static_cast<std::ptrdiff_t>(size());
+    }
+
+    typename iterator::reference operator[](std::size_t i)
+    {
+        return begin()[static_cast<std::ptrdiff_t>(i)];
+    }
+
+    typename const_iterator::reference operator[](std::size_t i) const
+    {
+        return begin()[static_cast<std::ptrdiff_t>(i)];
+    }
+
+private:
+    template <
+            std::size_t... I
+            >
+    std::size_t size(index_sequence<I...>) const
+    {
+        const std::size_t sizes[] = {static_cast<std::size_t>(
+            std::distance(std::begin(std::get<I>(containers)), std::end(std::get<I>(containers)))
+        )...};
+        return details::min_value(sizes, 0, sizeof...(I));
+    }
+
+    template <
+            std::size_t... I
+            >
+    iterator begin(index_sequence<I...>)
+    {
+        return iterator(std::make_tuple(std::begin(std::get<I>(containers))...), 0);
+    }
+
+    template <
+            std::size_t... I
+            >
+    const_iterator begin(index_sequence<I...>) const
+    {
+        return const_iterator(std::make_tuple(details::const_begin<Containers>(std::get<I>(containers))...), 0);
+    }
+
+    std::tuple<Containers...> containers;
+};
+
+/**
+ * @brief Iterate over parallel containers in lockstep
+ * Example:
+ * @code
+ *   std::vector<float> x = {1, 2, 3}, y = {4, 5, 6, 7}, sum(3);
+ *   for (auto row : tuple_utils::zip_range(x, y, sum))
+ *   {
+ *       std::get<2>(row) = std::get<0>(row) + std::get<1>(row); //sum is equal to {5, 7, 9}
+ *   }
+ * @endcode
+ */
+template <
+        typename First,
+        typename... Rest
+        >
+zipped_range<First, Rest...> zip_range(First&& first, Rest&&... rest)
+{
+    return zipped_range<First, Rest...>(std::forward<First>(first), std::forward<Rest>(rest)...);
+}
+
+} //namespace tuple_utils
+
+#endif // ZIP_RANGE_H
@@ -3,6 +3,8 @@
 
 #include <tuple>
 #include <type_traits>
+#include "aux/get.hpp"
+#include "aux/sequence.hpp"
 #include "aux/traits.hpp"
 
 /**
@@ -19,104 +21,74 @@ namespace details
 {
 
 /**
- * @brief Create std::tuple of std::tuples with elements equal to elements from tuples at given positions
- * Each std::tuple in resulting std::tuple contains elements from tuples given as parameters. They are
- * constructed in such a way that index of resulting std::tuples describes which values from passed tuples will
- * they contain (e.g. tuple at index zero in result will contain all values at index zero from tuples passed).
- * Each tuple is constructed recursively from index 0 to End, where End is equal to the size of the smallest
- * tuple from parameter pack.
- * @tparam Curr - current index which will be used to get values
- * @tparam End - size of the smallest tuple passed through Tuple... parameter pack
- * @tparam Tuple... - parameter pack containing types of std::tuple's passed to tuple_utils::zip
+ * @brief Policy creating rows of tuple_utils::zip, std::tuples with copies of elements
  */
-template <
-        std::size_t Curr,
-        std::size_t End,
-        typename... Tuple
-        >
-struct zip_det
+struct zip_values
 {
     /**
-     * @brief Fill resulting std::tuple with values at given index recursively
-     * Create std::tuple and fill it using pack expansion so that in one step values from all arguments are
-     * used. Increment index and call itself recursively until index hits end.
-     * @param tuple - arbitrary number of tuples to be zipped
-     * @return tuple<tuple<get<0>(args)...>, tuple<get<1>(args)>...>,... tuple<get<N>(args)...>>
+     * @brief Create one row of the zipped result, std::tuple with elements at index I from all tuples
+     * References to the zipped tuples are kept in refs, so elements of rvalue tuples are moved.
+     * @tparam I - index of elements taken from each tuple
+     * @tparam T... - indices of tuples in refs, sequence 0, 1,..., sizeof...(Tuples)-1
+     * @tparam Tuples... - lvalue or rvalue references to the zipped tuples
      */
-    static auto go(const Tuple&... tuple)
-    -> decltype(std::tuple_cat(
-                            std::make_tuple(std::make_tuple(std::get<Curr>(tuple)...)),
-                            zip_det<Curr + 1, End, Tuple...>::go(tuple...)
-                        ))
+    template <
+            std::size_t I,
+            std::size_t... T,
+            typename... Tuples
+            >
+    static auto row(index_sequence<T...>, const std::tuple<Tuples...>& refs)
+    -> decltype(std::make_tuple(tuple_get<I>(std::forward<Tuples>(std::get<T>(refs)))...))
     {
-        auto one_tuple = std::make_tuple(std::get<Curr>(tuple)...);
-        auto result = std::tuple_cat(std::make_tuple(one_tuple), zip_det<Curr + 1, End, Tuple...>::go(tuple...));
-        return result;
+        return std::make_tuple(tuple_get<I>(std::forward<Tuples>(std::get<T>(refs)))...);
     }
 };
 
 /**
- * @brief Helper struct used to limit the recursion, used when index used for zipping hits last element
- * @tparam End - size of the smallest tuple passed, used to delimit recursion
- * @tparam Tuple... - parameter pack containing types of std::tuple's passed to tuple_utils::zip
+ * @brief Policy creating rows of tuple_utils::zip_ref, std::tuples of references to elements
  */
-template <
-        std::size_t End,
-        typename... Tuple
-        >
-struct zip_det<End, End, Tuple...>
+struct zip_references
 {
     /**
-     * @brief Return nested std::tuple with values from End index taken from arguments
-     * After getting values at End index it stops recursion and result could be passed to tuple_utils::zip.
-     * Returned value is std::tuple of std::tuples so it could be concatenated later.
+     * @brief Create one row of the zipped result, std::tuple with references to elements at index I
+     * Each reference has the value category of its tuple, as returned by tuple_get.
      */
-    static auto go(const Tuple&... tuple)
-    -> decltype(std::make_tuple(std::make_tuple(std::get<End>(tuple)...)))
+    template <
+            std::size_t I,
+            std::size_t... T,
+            typename... Tuples
+            >
+    static auto row(index_sequence<T...>, const std::tuple<Tuples...>& refs)
+    -> std::tuple<typename tuple_get_type<I, Tuples>::type...>
     {
-        return std::make_tuple(std::make_tuple(std::get<End>(tuple)...));
+        return std::tuple<typename tuple_get_type<I, Tuples>::type...>(
+                    tuple_get<I>(std::forward<Tuples>(std::get<T>(refs)))...
+                );
     }
 };
 
 /**
- * @brief Proxy function used as a tag dispatcher, performs actual zipping
- * Hit only when there are no empty tuples passed to tuple_utils::zip
+ * @brief Create std::tuple of std::tuples with elements equal to elements from tuples at given positions
+ * Each std::tuple in resulting std::tuple contains elements from tuples given as parameters. They are
+ * constructed in such a way that index of resulting std::tuples describes which values from passed tuples will
+ * they contain (e.g. tuple at index zero in result will contain all values at index zero from tuples passed).
+ * All rows are created with one pack expansion over I, each row exactly once, so the number of
+ * instantiations and element moves is linear with respect to the number of rows.
+ * @tparam Rows - details::zip_values or details::zip_references, creates each row
+ * @tparam I... - sequence 0, 1,..., N-1 where N is equal to the size of the smallest tuple
+ * @return tuple<tuple<get<0>(args)...>, tuple<get<1>(args)>...>,... tuple<get<N-1>(args)...>>
  */
 template <
-        typename First,
-        typename... Rest
+        typename Rows,
+        std::size_t... I,
+        typename... Tuples
         >
-auto zip_proxy(std::false_type, First&& first, Rest&&... rest)
--> decltype(details::zip_det<
-                0,
-                tsize_min<typename std::decay<First>::type, typename std::decay<Rest>::type...>::value - 1,
-                First,
-                Rest...
-            >::go(first, rest...))
+auto zip_det(index_sequence<I...>, const std::tuple<Tuples...>& refs)
+-> std::tuple<decltype(Rows::template row<I>(index_sequence_for<Tuples...>(), refs))...>
 {
-    constexpr std::size_t size = tsize_min<
-                typename std::decay<First>::type,
-                typename std::decay<Rest>::type...
-            >::value - 1;
-
-    auto result = details::zip_det<0, size, First, Rest...>::go(
-                std::forward<First>(first),
-                std::forward<Rest>(rest)...
+    return std::tuple<decltype(Rows::template row<I>(index_sequence_for<Tuples...>(), refs))...>(
+                Rows::template row<I>(index_sequence_for<Tuples...>(), refs)...
             );
-
-    return result;
-}
-
-/**
- * @brief Proxy function used as a tag dispatcher, because one or more tuples were empty it returns empty tuple
- */
-template <
-        typename First,
-        typename... Rest
-        >
-std::tuple<> zip_proxy(std::true_type, First&&, Rest&&...)
-{
-    return std::tuple<>();
 }
 
 }//namespace details
@@ -125,8 +97,8 @@ std::tuple<> zip_proxy(std::true_type, First&&, Rest&&...)
  * @brief Zip together values at corresponding indexes of arbitrary number of std::tuples
  * For each index create one std::tuple with values taken from std::tuples passed as arguments. Result
  * will contain tuples created starting from index zero up to index equal to the size of the smalles tuple
- * passed as an argument. Use tag dispatch and details::zip_proxy to check if any std::tuple given as parameter
- * is empty, if so then tuple_utils::zip should return empty std::tuple<>
+ * passed as an argument, so if any std::tuple given as parameter is empty then tuple_utils::zip returns empty
+ * std::tuple<>. Elements of rvalue tuples are moved.
  * Example:
  * @code
  *   auto result = tuple_utils::zip(make_tuple(1, 4, 2.2, "test"), make_tuple(2, 2.2, 1), make_tuple(4, 6, 9));
@@ -139,14 +111,53 @@ template <
         typename... Tuples
         >
 auto zip(Tuples&&... tuples)
--> decltype(details::zip_proxy(
-                        std::integral_constant<bool, contain_empty<Tuples...>::value>(),
-                        std::forward<Tuples>(tuples)...
-                    ))
+-> decltype(details::zip_det<details::zip_values>(
+                    make_index_sequence<tsize_min<Tuples...>::value>(),
+                    std::tuple<Tuples&&...>(std::forward<Tuples>(tuples)...)
+                ))
+{
+    return details::zip_det<details::zip_values>(
+                    make_index_sequence<tsize_min<Tuples...>::value>(),
+                    std::tuple<Tuples&&...>(std::forward<Tuples>(tuples)...)
+                );
+}
+
+/**
+ * @brief Special case when no arguments are given, simply return empty std::tuple
+ * @return Empty std::tuple<>
+ */
+inline std::tuple<> zip()
+{
+    return std::tuple<>();
+}
+
+/**
+ * @brief Zip together references to elements at corresponding indexes of arbitrary number of std::tuples
+ * Works as tuple_utils::zip, but each row is a std::tuple of references to the elements of zipped tuples,
+ * so nothing is copied. Elements of lvalue tuples are referenced by lvalue references and could be modified
+ * through the result, const tuples give const references and rvalue tuples give rvalue references, so their
+ * elements could be moved out. As for std::forward_as_tuple the result should not outlive the arguments.
+ * Example:
+ * @code
+ *   auto x = std::make_tuple(1, 2.5);
+ *   auto y = std::make_tuple(std::string("a"), 'b', 3);
+ *   auto result = tuple_utils::zip_ref(x, y);
+ *   //result is equal to tuple<tuple<int&, std::string&>, tuple<double&, char&>>
+ *   std::get<0>(std::get<0>(result)) = 5; //x is equal to (5, 2.5)
+ * @endcode
+ */
+template <
+        typename... Tuples
+        >
+auto zip_ref(Tuples&&... tuples)
+-> decltype(details::zip_det<details::zip_references>(
+                    make_index_sequence<tsize_min<Tuples...>::value>(),
+                    std::tuple<Tuples&&...>(std::forward<Tuples>(tuples)...)
+                ))
 {
-    return details::zip_proxy(
-                    std::integral_constant<bool, contain_empty<Tuples...>::value>(),
-                    std::forward<Tuples>(tuples)...
+    return details::zip_det<details::zip_references>(
+                    make_index_sequence<tsize_min<Tuples...>::value>(),
+                    std::tuple<Tuples&&...>(std::forward<Tuples>(tuples)...)
                 );
 }
 
@@ -154,7 +165,7 @@ auto zip(Tuples&&... tuples)
  * @brief Special case when no arguments are given, simply return empty std::tuple
  * @return Empty std::tuple<>
  */
-std::tuple<> zip()
+inline std::tuple<> zip_ref()
 {
     return std::tuple<>();
 }
@@ -0,0 +1,133 @@
+#ifndef COUNTED_HPP
+#define COUNTED_HPP
+
+#include <cstddef>
+#include <tuple>
+#include <iostream>
+#include "../src/aux/sequence.hpp"
+
+/*
+ * Instrumented element type used by tests and benchmarks to audit how tuple_utils algorithms
+ * handle their elements. Every special member function of Counted increments its own counter,
+ * so comparing counters before and after a call shows how many copies, moves, default
+ * constructions and assignments the call performed.
+ */
+
+/**
+ * @brief Numbers of special member function calls performed on Counted objects
+ */
+struct OperationCounts
+{
+    std::size_t constructions = 0;
+    std::size_t defaultConstructions = 0;
+    std::size_t copies = 0;
+    std::size_t moves = 0;
+    std::size_t copyAssignments = 0;
+    std::size_t moveAssignments = 0;
+    std::size_t destructions = 0;
+};
+
+/**
+ * @brief Global counters shared by all Counted objects
+ */
+inline OperationCounts& operationCounts()
+{
+    static OperationCounts counts;
+    return counts;
+}
+
+/**
+ * @brief Reset all counters to zero, usually called just before the audited call
+ */
+inline void resetOperationCounts()
+{
+    operationCounts() = OperationCounts();
+}
+
+/**
+ * @brief Element type which counts calls of its special member functions
+ */
+struct Counted
+{
+    Counted() : value(0)
+    {
+        ++operationCounts().defaultConstructions;
+    }
+
+    explicit Counted(int v) : value(v)
+    {
+        ++operationCounts().constructions;
+    }
+
+    Counted(const Counted& other) : value(other.value)
+    {
+        ++operationCounts().copies;
+    }
+
+    Counted(Counted&& other) noexcept : value(other.value)
+    {
+        ++operationCounts().moves;
+    }
+
+    Counted& operator=(const Counted& other)
+    {
+        value = other.value;
+        ++operationCounts().copyAssignments;
+        return *this;
+    }
+
+    Counted& operator=(Counted&& other) noexcept
+    {
+        value = other.value;
+        ++operationCounts().moveAssignments;
+        return *this;
+    }
+
+    ~Counted()
+    {
+        ++operationCounts().destructions;
+    }
+
+    int value;
+};
+
+inline bool operator==(const Counted& left, const Counted& right)
+{
+    return left.value == right.value;
+}
+
+inline std::ostream& operator<<(std::ostream& stream, const Counted& counted)
+{
+    return stream << counted.value;
+}
+
+/**
+ * @brief Alias used to repeat Counted type once for each index of a pack
+ */
+template <std::size_t>
+using CountedAt = Counted;
+
+/**
+ * @brief Create std::tuple of Counted objects with values 0, 1,..., N-1 for the given index sequence
+ */
+template <
+        std::size_t... I
+        >
+std::tuple<CountedAt<I>...> makeCountedTuple(tuple_utils::index_sequence<I...>)
+{
+    return std::tuple<CountedAt<I>...>(Counted(static_cast<int>(I))...);
+}
+
+/**
+ * @brief Create std::tuple with N Counted objects with values 0, 1,..., N-1
+ */
+template <
+        std::size_t N
+        >
+auto makeCountedTuple()
+-> decltype(makeCountedTuple(tuple_utils::make_index_sequence<N>()))
+{
+    return makeCountedTuple(tuple_utils::make_index_sequence<N>());
+}
+
+#endif // COUNTED_HPP
@@ -0,0 +1,509 @@
+#include "../src/merge_tuples.hpp"
+#include "../src/zip_tuples.hpp"
+#include "../src/unzip.hpp"
+#include "../src/fold_tuples.hpp"
+#include "../src/fold_rows.hpp"
+#include "../src/reduce.hpp"
+#include "../src/reverse.hpp"
+#include "../src/explode.hpp"
+#include "../src/cartesian_product.hpp"
+#include "../src/make_custom_tuple.hpp"
+#include "../src/index_view.hpp"
+#include "../src/aux/sequence_algebra.hpp"
+#include "counted.hpp"
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+/*
+ * Report numbers of copies, moves, default constructions and assignments of elements performed by
+ * tuple_utils algorithms for tuples of Counted objects of a few sizes. Each measurement has upper
+ * limits for copies and moves, default constructions and assignments are never expected. Any
+ * exceeded limit is reported as a regression and the program returns non-zero, so it is run by
+ * ctest next to the unit tests.
+ */
+
+/**
+ * @brief Binary function taking arguments by value, so every copy made by fold is visible
+ */
+struct AddByValue
+{
+    Counted operator()(Counted x, Counted y) const
+    {
+        return Counted(x.value + y.value);
+    }
+};
+
+/**
+ * @brief Accumulating function for fold_accumulate, modifies the accumulator in place
+ */
+struct AddInPlace
+{
+    void operator()(Counted& acc, const Counted& x) const
+    {
+        acc.value += x.value;
+    }
+};
+
+/**
+ * @brief Stateful binary function, its Counted member makes every copy of the functor visible
+ * operator() is not const and counts its calls, so the count is kept only when the algorithm calls the
+ * functor given to it instead of a copy.
+ */
+struct AddCountingCalls
+{
+    AddCountingCalls() : calls(0)
+    { }
+
+    Counted operator()(Counted x, Counted y)
+    {
+        ++calls.value;
+        return Counted(x.value + y.value);
+    }
+
+    Counted calls;
+};
+
+/**
+ * @brief Stateful accumulating function for fold_accumulate, copies are visible as for AddCountingCalls
+ */
+struct AddInPlaceCountingCalls
+{
+    AddInPlaceCountingCalls() : calls(0)
+    { }
+
+    void operator()(Counted& acc, const Counted& x)
+    {
+        ++calls.value;
+        acc.value += x.value;
+    }
+
+    Counted calls;
+};
+
+/**
+ * @brief Stateful transformation for transform_reduce, copies are visible as for AddCountingCalls
+ */
+struct NegateCountingCalls
+{
+    NegateCountingCalls() : calls(0)
+    { }
+
+    Counted operator()(const Counted& x)
+    {
+        ++calls.value;
+        return Counted(-x.value);
+    }
+
+    Counted calls;
+};
+
+/**
+ * @brief Function taking any number of arguments by value, so every copy made by explode is visible
+ */
+struct SinkByValue
+{
+    template <typename... T>
+    std::size_t operator()(T... values) const
+    {
+        return sizeof...(values);
+    }
+};
+
+/**
+ * @brief Collect measurements, print them and remember if any limit was exceeded
+ */
+class Report
+{
+public:
+    Report() : regressions(0)
+    {
+        std::cout << std::left
+                  << std::setw(20) << "algorithm"
+                  << std::setw(6) << "size"
+                  << std::setw(9) << "input"
+                  << std::setw(9) << "copies"
+                  << std::setw(9) << "moves"
+                  << std::setw(9) << "defaults"
+                  << std::setw(9) << "assigns" << std::endl;
+    }
+
+    /**
+     * @brief Print counters gathered since the last resetOperationCounts call and check them against limits
+     */
+    void add(const char* algorithm, std::size_t size, const char* input, std::size_t maxCopies, std::size_t maxMoves)
+    {
+        const OperationCounts counts = operationCounts();
+        const std::size_t assignments = counts.copyAssignments + counts.moveAssignments;
+
+        std::cout << std::left
+                  << std::setw(20) << algorithm
+                  << std::setw(6) << size
+                  << std::setw(9) << input
+                  << std::setw(9) << counts.copies
+                  << std::setw(9) << counts.moves
+                  << std::setw(9) << counts.defaultConstructions
+                  << std::setw(9) << assignments << std::endl;
+
+        if (counts.copies > maxCopies || counts.moves > maxMoves
+                || counts.defaultConstructions != 0 || assignments != 0)
+        {
+            std::cout << "REGRESSION: " << algorithm << " (" << size << ", " << input << ") expected at most "
+                      << maxCopies << " copies and " << maxMoves << " moves, no default constructions "
+                      << "and no assignments" << std::endl;
+            ++regressions;
+        }
+    }
+
+    /**
+     * @brief Check that the functor given to the algorithm was called, not its copies
+     */
+    void addCalls(const char* algorithm, std::size_t size, const Counted& calls, std::size_t expected)
+    {
+        if (calls.value != static_cast<int>(expected))
+        {
+            std::cout << "REGRESSION: " << algorithm << " (" << size << ") expected " << expected
+                      << " calls of the given functor, counted " << calls.value << std::endl;
+            ++regressions;
+        }
+    }
+
+    int result() const
+    {
+        return regressions == 0 ? 0 : 1;
+    }
+
+private:
+    std::size_t regressions;
+};
+
+/**
+ * @brief Measure all algorithms for tuples with N elements, both for lvalue and rvalue arguments
+ */
+template <
+        std::size_t N
+        >
+void reportSize(Report& report)
+{
+    {
+        auto x = makeCountedTuple<N>();
+        auto y = makeCountedTuple<N>();
+        resetOperationCounts();
+        auto result = tuple_utils::merge(x, y);
+        report.add("merge", N, "lvalue", 2 * N, 0);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        auto y = makeCountedTuple<N>();
+        resetOperationCounts();
+        auto result = tuple_utils::merge(std::move(x), std::move(y));
+        report.add("merge", N, "rvalue", 0, 2 * N);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        auto y = makeCountedTuple<N>();
+        resetOperationCounts();
+        auto result = tuple_utils::zip(x, y);
+        //every row is created once and moved once into the result
+        report.add("zip", N, "lvalue", 2 * N, 2 * N);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        auto y = makeCountedTuple<N>();
+        resetOperationCounts();
+        auto result = tuple_utils::zip(std::move(x), std::move(y));
+        report.add("zip", N, "rvalue", 0, 4 * N);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        auto y = makeCountedTuple<N>();
+        resetOperationCounts();
+        auto result = tuple_utils::zip_ref(x, y);
+        report.add("zip_ref", N, "lvalue", 0, 0);
+        (void)result;
+    }
+    {
+        std::vector<decltype(makeCountedTuple<N>())> rows;
+        rows.push_back(makeCountedTuple<N>());
+        rows.push_back(makeCountedTuple<N>());
+        resetOperationCounts();
+        auto result = tuple_utils::unzip(rows);
+        report.add("unzip(2 rows)", N, "lvalue", 2 * N, 0);
+        (void)result;
+    }
+    {
+        std::vector<decltype(makeCountedTuple<N>())> rows;
+        rows.push_back(makeCountedTuple<N>());
+        rows.push_back(makeCountedTuple<N>());
+        resetOperationCounts();
+        auto result = tuple_utils::unzip(std::move(rows));
+        report.add("unzip(2 rows)", N, "rvalue", 0, 2 * N);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        auto y = makeCountedTuple<N>();
+        resetOperationCounts();
+        auto result = tuple_utils::fold(AddByValue(), x, y);
+        report.add("fold", N, "lvalue", 2 * N, N);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        auto y = makeCountedTuple<N>();
+        resetOperationCounts();
+        auto result = tuple_utils::fold(AddByValue(), std::move(x), std::move(y));
+        report.add("fold", N, "rvalue", 0, 3 * N);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        auto y = makeCountedTuple<N>();
+        resetOperationCounts();
+        auto result = tuple_utils::fold(AddByValue(), x, y, x, y);
+        //each argument is copied into f once and each partial result is moved once, in every order
+        report.add("fold(4 tuples)", N, "lvalue", 4 * N, 3 * N);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        auto y = makeCountedTuple<N>();
+        resetOperationCounts();
+        auto result = tuple_utils::fold_left(AddByValue(), x, y, x, y);
+        report.add("fold_left(4 tuples)", N, "lvalue", 4 * N, 3 * N);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        auto y = makeCountedTuple<N>();
+        resetOperationCounts();
+        auto result = tuple_utils::fold_tree(AddByValue(), x, y, x, y);
+        report.add("fold_tree(4 tuples)", N, "lvalue", 4 * N, 3 * N);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        auto y = makeCountedTuple<N>();
+        resetOperationCounts();
+        auto result = tuple_utils::fold_accumulate(AddInPlace(), x, y, x, y);
+        //only accumulators are copied from the first tuple, then moved into the result
+        report.add("fold_accumulate(4)", N, "lvalue", N, N);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        auto y = makeCountedTuple<N>();
+        resetOperationCounts();
+        auto result = tuple_utils::fold_accumulate(AddInPlace(), std::move(x), std::move(y), y, y);
+        report.add("fold_accumulate(4)", N, "rvalue", 0, 2 * N);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        resetOperationCounts();
+        auto result = tuple_utils::reduce_tree(AddByValue(), x);
+        //each element is copied into f once, each partial result is moved into f once
+        report.add("reduce_tree", N, "lvalue", N, N);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        resetOperationCounts();
+        auto result = tuple_utils::reduce(AddByValue(), std::move(x));
+        report.add("reduce", N, "rvalue", 0, 2 * N);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        resetOperationCounts();
+        auto result = tuple_utils::inclusive_scan(AddByValue(), std::move(x));
+        //partial results are kept, so each of them is copied into f, then moved into the result once
+        report.add("inclusive_scan", N, "rvalue", N, 2 * N);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        auto y = makeCountedTuple<N>();
+        AddCountingCalls f;
+        resetOperationCounts();
+        auto result = tuple_utils::fold(f, x, y, x, y);
+        //limits of the stateless functor, any copy of f would exceed them
+        report.add("fold(stateful f)", N, "lvalue", 4 * N, 3 * N);
+        report.addCalls("fold(stateful f)", N, f.calls, 3 * N);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        auto y = makeCountedTuple<N>();
+        AddCountingCalls f;
+        resetOperationCounts();
+        auto result = tuple_utils::fold_left(f, x, y, x, y);
+        report.add("fold_left(stateful)", N, "lvalue", 4 * N, 3 * N);
+        report.addCalls("fold_left(stateful)", N, f.calls, 3 * N);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        auto y = makeCountedTuple<N>();
+        AddCountingCalls f;
+        resetOperationCounts();
+        auto result = tuple_utils::fold_tree(f, x, y, x, y);
+        report.add("fold_tree(stateful)", N, "lvalue", 4 * N, 3 * N);
+        report.addCalls("fold_tree(stateful)", N, f.calls, 3 * N);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        auto y = makeCountedTuple<N>();
+        AddInPlaceCountingCalls op;
+        resetOperationCounts();
+        auto result = tuple_utils::fold_accumulate(op, x, y, x, y);
+        report.add("fold_accumulate(st)", N, "lvalue", N, N);
+        report.addCalls("fold_accumulate(st)", N, op.calls, 3 * N);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        AddCountingCalls f;
+        resetOperationCounts();
+        auto result = tuple_utils::reduce_tree(f, x);
+        report.add("reduce_tree(st)", N, "lvalue", N, N);
+        report.addCalls("reduce_tree(st)", N, f.calls, N - 1);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        AddCountingCalls f;
+        NegateCountingCalls g;
+        resetOperationCounts();
+        auto result = tuple_utils::transform_reduce(f, g, x);
+        //results of g are moved into f, no element is copied
+        report.add("transform_reduce(st)", N, "lvalue", 0, 2 * N);
+        report.addCalls("transform_reduce(st)", N, f.calls, N - 1);
+        report.addCalls("transform_reduce(st)", N, g.calls, N);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        AddCountingCalls f;
+        resetOperationCounts();
+        auto result = tuple_utils::inclusive_scan(f, std::move(x));
+        report.add("inclusive_scan(st)", N, "rvalue", N, 2 * N);
+        report.addCalls("inclusive_scan(st)", N, f.calls, N - 1);
+        (void)result;
+    }
+    {
+        //two rows, the result is created directly from f called for each column, without assignments
+        std::vector<decltype(makeCountedTuple<N>())> rows {makeCountedTuple<N>(), makeCountedTuple<N>()};
+        AddCountingCalls f;
+        resetOperationCounts();
+        auto result = tuple_utils::fold_rows(f, rows);
+        report.add("fold_rows(stateful)", N, "lvalue", 2 * N, N);
+        report.addCalls("fold_rows(stateful)", N, f.calls, N);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        resetOperationCounts();
+        auto result = tuple_utils::reverse(x);
+        report.add("reverse", N, "lvalue", N, 0);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        resetOperationCounts();
+        auto result = tuple_utils::reverse(std::move(x));
+        report.add("reverse", N, "rvalue", 0, N);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        resetOperationCounts();
+        tuple_utils::explode(SinkByValue(), x);
+        report.add("explode", N, "lvalue", N, 0);
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        resetOperationCounts();
+        tuple_utils::explode(SinkByValue(), std::move(x));
+        report.add("explode", N, "rvalue", 0, N);
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        auto y = makeCountedTuple<2>();
+        resetOperationCounts();
+        auto result = tuple_utils::c_product(x, y);
+        //every combination is created once and moved once into the result
+        report.add("c_product(N x 2)", N, "lvalue", 4 * N, 4 * N);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        auto y = makeCountedTuple<2>();
+        resetOperationCounts();
+        auto result = tuple_utils::c_product(std::move(x), std::move(y));
+        //each element of x is used twice and each element of y is used N times, only last uses are moved
+        report.add("c_product(N x 2)", N, "rvalue", 3 * N - 2, 5 * N + 2);
+        (void)result;
+    }
+    {
+        using reversed = typename tuple_utils::sequence_reverse<tuple_utils::make_index_sequence<N>>::type;
+        auto x = makeCountedTuple<N>();
+        resetOperationCounts();
+        auto result = tuple_utils::make_custom_tuple(x, reversed());
+        report.add("make_custom_tuple", N, "lvalue", N, 0);
+        (void)result;
+    }
+    {
+        using reversed = typename tuple_utils::sequence_reverse<tuple_utils::make_index_sequence<N>>::type;
+        auto x = makeCountedTuple<N>();
+        resetOperationCounts();
+        auto result = tuple_utils::make_custom_tuple(std::move(x), reversed());
+        report.add("make_custom_tuple", N, "rvalue", 0, N);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        auto y = makeCountedTuple<N>();
+        resetOperationCounts();
+        auto result = tuple_utils::materialize(tuple_utils::view_reverse(tuple_utils::view_merge(x, y)));
+        //reverse(merge(x, y)) without the intermediate merged tuple, each element is copied once
+        report.add("view pipeline", N, "lvalue", 2 * N, 0);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        auto y = makeCountedTuple<N>();
+        resetOperationCounts();
+        auto result = tuple_utils::materialize(
+                    tuple_utils::view_reverse(tuple_utils::view_merge(std::move(x), std::move(y)))
+                );
+        //rvalue tuples are moved once into the merged view, the reversed view takes them over without
+        //moving any element, then elements are moved into the result
+        report.add("view pipeline", N, "rvalue", 0, 4 * N);
+        (void)result;
+    }
+    {
+        auto x = makeCountedTuple<N>();
+        auto y = makeCountedTuple<N>();
+        resetOperationCounts();
+        tuple_utils::explode(SinkByValue(), tuple_utils::view_reverse(tuple_utils::view_merge(x, y)));
+        report.add("explode(view)", N, "lvalue", 2 * N, 0);
+    }
+}
+
+int main()
+{
+    Report report;
+    reportSize<1>(report);
+    reportSize<8>(report);
+    reportSize<32>(report);
+    return report.result();
+}
@@ -0,0 +1,194 @@
+#include "../src/c_product_view.hpp"
+#include "../src/cartesian_product.hpp"
+#include "../src/explode.hpp"
+#include <tuple>
+#include <string>
+#include <memory>
+#include <type_traits>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestCase.h>
+#include <cppunit/TestFixture.h>
+
+class TestCProductView : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestCProductView);
+    CPPUNIT_TEST(testGet);
+    CPPUNIT_TEST(testReferences);
+    CPPUNIT_TEST(testConstTuple);
+    CPPUNIT_TEST(testRvalueTuple);
+    CPPUNIT_TEST(testTupleTraits);
+    CPPUNIT_TEST(testEmptyTuple);
+    CPPUNIT_TEST(testExplode);
+    CPPUNIT_TEST(testMaterialize);
+    CPPUNIT_TEST(testMaterializeMove);
+    CPPUNIT_TEST(testMaterializeMoveOnly);
+    CPPUNIT_TEST_SUITE_END();
+public:
+    void setUp();
+    void tearDown();
+protected:
+    void testGet();
+    void testReferences();
+    void testConstTuple();
+    void testRvalueTuple();
+    void testTupleTraits();
+    void testEmptyTuple();
+    void testExplode();
+    void testMaterialize();
+    void testMaterializeMove();
+    void testMaterializeMoveOnly();
+};
+
+void TestCProductView::setUp()
+{}
+
+void TestCProductView::tearDown()
+{}
+
+void TestCProductView::testGet()
+{
+    auto x = std::make_tuple(1, 2);
+    auto y = std::make_tuple('a', 'b', 'c');
+    auto z = std::make_tuple(std::string("u"), 0.5);
+    auto view = tuple_utils::make_c_product_view(x, y, z);
+
+    CPPUNIT_ASSERT(std::make_tuple(1, 'a', std::string("u")) == tuple_utils::get<0>(view));
+    CPPUNIT_ASSERT(std::make_tuple(1, 'a', 0.5) == tuple_utils::get<1>(view));
+    CPPUNIT_ASSERT(std::make_tuple(1, 'b', std::string("u")) == tuple_utils::get<2>(view));
+    CPPUNIT_ASSERT(std::make_tuple(1, 'c', 0.5) == tuple_utils::get<5>(view));
+    CPPUNIT_ASSERT(std::make_tuple(2, 'a', std::string("u")) == tuple_utils::get<6>(view));
+    CPPUNIT_ASSERT(std::make_tuple(2, 'c', 0.5) == tuple_utils::get<11>(view));
+}
+
+void TestCProductView::testReferences()
+{
+    auto x = std::make_tuple(1, 2);
+    auto y = std::make_tuple(std::string("a"), std::string("b"));
+    auto view = tuple_utils::make_c_product_view(x, y);
+    auto element = tuple_utils::get<3>(view);
+
+    static_assert(std::is_same<decltype(element), std::tuple<int&, std::string&>>::value, "Type mismatch");
+
+    CPPUNIT_ASSERT(&std::get<1>(x) == &std::get<0>(element));
+    CPPUNIT_ASSERT(&std::get<1>(y) == &std::get<1>(element));
+
+    std::get<1>(element) += "c";
+    CPPUNIT_ASSERT("bc" == std::get<1>(y));
+    CPPUNIT_ASSERT("bc" == std::get<1>(tuple_utils::get<1>(view)));
+}
+
+void TestCProductView::testConstTuple()
+{
+    const auto x = std::make_tuple(1, 2);
+    auto view = tuple_utils::make_c_product_view(x, std::make_tuple('a'));
+
+    static_assert(std::is_same<decltype(tuple_utils::get<0>(view)), std::tuple<const int&, const char&>>::value,
+                  "Type mismatch");
+
+    CPPUNIT_ASSERT(std::make_tuple(2, 'a') == tuple_utils::get<1>(view));
+}
+
+void TestCProductView::testRvalueTuple()
+{
+    auto x = std::make_tuple(1, 2);
+    auto y = std::make_tuple(std::string("a"), std::string("b"));
+    auto view = tuple_utils::make_c_product_view(x, std::move(y));
+
+    //rvalue tuple is moved into the view, lvalue tuple is only referenced
+    static_assert(std::is_same<decltype(view.tuples), std::tuple<std::tuple<int, int>&,
+                               std::tuple<std::string, std::string>>>::value, "Type mismatch");
+    CPPUNIT_ASSERT(&x == &std::get<0>(view.tuples));
+    CPPUNIT_ASSERT(std::get<0>(y).empty());
+    CPPUNIT_ASSERT(&std::get<1>(std::get<1>(view.tuples)) == &std::get<1>(tuple_utils::get<3>(view)));
+    CPPUNIT_ASSERT(std::make_tuple(2, std::string("b")) == tuple_utils::get<3>(view));
+}
+
+void TestCProductView::testTupleTraits()
+{
+    auto x = std::make_tuple(1, 2, 3);
+    auto y = std::make_tuple(std::string("a"), 0.5);
+    using view_type = decltype(tuple_utils::make_c_product_view(x, y));
+
+    static_assert(6 == std::tuple_size<view_type>::value, "Size mismatch");
+    static_assert(std::is_same<std::tuple_element<0, view_type>::type, std::tuple<int, std::string>>::value,
+                  "Type mismatch");
+    static_assert(std::is_same<std::tuple_element<5, view_type>::type, std::tuple<int, double>>::value,
+                  "Type mismatch");
+    CPPUNIT_ASSERT(6 == std::tuple_size<view_type>::value);
+}
+
+void TestCProductView::testEmptyTuple()
+{
+    auto x = std::make_tuple(1, 2, 3);
+    auto view = tuple_utils::make_c_product_view(x, std::tuple<>(), x);
+
+    CPPUNIT_ASSERT(0 == std::tuple_size<decltype(view)>::value);
+    CPPUNIT_ASSERT(std::tuple<>() == tuple_utils::materialize(view));
+}
+
+void TestCProductView::testExplode()
+{
+    auto x = std::make_tuple(1, 2);
+    auto y = std::make_tuple(10, 20);
+    auto view = tuple_utils::make_c_product_view(x, y);
+
+    auto sum = tuple_utils::explode([](std::tuple<int&, int&> a, std::tuple<int&, int&> b,
+                                       std::tuple<int&, int&> c, std::tuple<int&, int&> d)
+    {
+        return std::get<0>(a) * std::get<1>(a) + std::get<0>(b) * std::get<1>(b)
+                + std::get<0>(c) * std::get<1>(c) + std::get<0>(d) * std::get<1>(d);
+    }, view);
+    CPPUNIT_ASSERT(90 == sum);
+}
+
+void TestCProductView::testMaterialize()
+{
+    auto x = std::make_tuple(6, 3);
+    auto y = std::make_tuple("xxx", 5.3);
+    auto z = std::make_tuple(7, -2);
+    auto result = tuple_utils::materialize(tuple_utils::make_c_product_view(x, y, z));
+
+    static_assert(std::is_same<decltype(result), decltype(tuple_utils::c_product(x, y, z))>::value,
+                  "Type mismatch");
+    CPPUNIT_ASSERT(tuple_utils::c_product(x, y, z) == result);
+}
+
+void TestCProductView::testMaterializeMove()
+{
+    auto x = std::make_tuple(std::string("a"), std::string("b"));
+    auto y = std::make_tuple(1, 2);
+    auto z = std::make_tuple(std::string("z"));
+    auto result = tuple_utils::materialize(tuple_utils::make_c_product_view(std::move(x), y, std::move(z)));
+
+    CPPUNIT_ASSERT(4 == std::tuple_size<decltype(result)>::value);
+    CPPUNIT_ASSERT(std::make_tuple(std::string("a"), std::string("z")) ==
+                   std::make_tuple(std::get<0>(std::get<0>(result)), std::get<2>(std::get<0>(result))));
+    CPPUNIT_ASSERT(std::make_tuple(std::string("b"), std::string("z")) ==
+                   std::make_tuple(std::get<0>(std::get<3>(result)), std::get<2>(std::get<3>(result))));
+    //x and z were moved into the view, then their elements were moved on the last use
+    CPPUNIT_ASSERT(std::get<0>(x).empty());
+    CPPUNIT_ASSERT(std::get<0>(z).empty());
+}
+
+void TestCProductView::testMaterializeMoveOnly()
+{
+    auto x = std::make_tuple(std::unique_ptr<int>(new int(1)), std::unique_ptr<int>(new int(2)));
+    auto result = tuple_utils::materialize(tuple_utils::make_c_product_view(std::move(x), std::make_tuple(3)));
+
+    CPPUNIT_ASSERT(1 == *std::get<0>(std::get<0>(result)));
+    CPPUNIT_ASSERT(3 == std::get<1>(std::get<1>(result)));
+    CPPUNIT_ASSERT(nullptr == std::get<1>(x));
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestCProductView );
+
+int main()
+{
+    CppUnit::TextUi::TestRunner runner;
+    CppUnit::TestFactoryRegistry &registry = CppUnit::TestFactoryRegistry::getRegistry();
+    runner.addTest(registry.makeTest());
+    bool wasSuccessful = runner.run("", false);
+    return wasSuccessful;
+}
@@ -2,6 +2,7 @@
 #include <string>
 #include <limits>
 #include <cmath>
+#include <memory>
 #include <cppunit/extensions/TestFactoryRegistry.h>
 #include <cppunit/ui/text/TestRunner.h>
 #include <cppunit/extensions/HelperMacros.h>
@@ -29,6 +30,8 @@ class TestCartesianProduct : public CppUnit::TestFixture
     CPPUNIT_TEST(testOneEmpty);
     CPPUNIT_TEST(testDuplicatedElement);
     CPPUNIT_TEST(test2xSameElement);
+    CPPUNIT_TEST(testMoveOnly);
+    CPPUNIT_TEST(testRvalueMovedOnLastUse);
     CPPUNIT_TEST_SUITE_END();
 public:
     void setUp();
@@ -50,6 +53,8 @@ protected:
     void testOneEmpty();
     void testDuplicatedElement();
     void test2xSameElement();
+    void testMoveOnly();
+    void testRvalueMovedOnLastUse();
 };
 
 void TestCartesianProduct::setUp()
@@ -480,6 +485,35 @@ void TestCartesianProduct::test2xSameElement()
     CPPUNIT_ASSERT(std::make_tuple(3.5f, 3.5f) == std::get<8>(result));
 }
 
+void TestCartesianProduct::testMoveOnly()
+{
+    auto arg2 = std::make_tuple(std::string("copied"));
+    auto result = tuple_utils::c_product(
+        std::make_tuple(std::unique_ptr<int>(new int(1)), std::unique_ptr<int>(new int(2))),
+        arg2,
+        std::make_tuple(3)
+    );
+
+    static_assert(2 == std::tuple_size<decltype(result)>::value, "Size mismatch");
+    CPPUNIT_ASSERT(1 == *std::get<0>(std::get<0>(result)));
+    CPPUNIT_ASSERT("copied" == std::get<1>(std::get<0>(result)));
+    CPPUNIT_ASSERT(2 == *std::get<0>(std::get<1>(result)));
+    CPPUNIT_ASSERT("copied" == std::get<1>(std::get<1>(result)));
+    CPPUNIT_ASSERT("copied" == std::get<0>(arg2));
+}
+
+void TestCartesianProduct::testRvalueMovedOnLastUse()
+{
+    auto arg1 = std::make_tuple(std::string("a"), std::string("b"));
+    auto arg2 = std::make_tuple(std::string("x"), std::string("y"));
+    auto result = tuple_utils::c_product(std::move(arg1), std::move(arg2));
+
+    CPPUNIT_ASSERT(std::make_tuple(std::string("a"), std::string("x")) == std::get<0>(result));
+    CPPUNIT_ASSERT(std::make_tuple(std::string("a"), std::string("y")) == std::get<1>(result));
+    CPPUNIT_ASSERT(std::make_tuple(std::string("b"), std::string("x")) == std::get<2>(result));
+    CPPUNIT_ASSERT(std::make_tuple(std::string("b"), std::string("y")) == std::get<3>(result));
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION( TestCartesianProduct );
 
 int main()
@@ -0,0 +1,152 @@
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestCase.h>
+#include <cppunit/TestFixture.h>
+#include "../src/dispatch_table.hpp"
+
+namespace
+{
+
+struct row_major
+{
+    static constexpr const char* name = "row";
+};
+
+struct column_major
+{
+    static constexpr const char* name = "column";
+};
+
+template <std::size_t W>
+using width = std::integral_constant<std::size_t, W>;
+
+/**
+ * @brief Describes the instantiation which was called, name of element type is given by its size
+ */
+struct describe_kernel
+{
+    template <typename T, typename Layout, typename Width>
+    static std::string apply(const std::string& prefix)
+    {
+        return prefix + std::to_string(sizeof(T)) + Layout::name + std::to_string(Width::value);
+    }
+};
+
+struct add_kernel
+{
+    template <typename T>
+    static constexpr int apply(int x)
+    {
+        return x + static_cast<int>(sizeof(T));
+    }
+};
+
+using describe_table = tuple_utils::dispatch_table<
+    std::string(const std::string&),
+    describe_kernel,
+    tuple_utils::type_list<float, double>,
+    tuple_utils::type_list<row_major, column_major>,
+    tuple_utils::type_list<width<1>, width<4>, width<8>>
+>;
+
+} //namespace
+
+class TestDispatchTable : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestDispatchTable);
+    CPPUNIT_TEST(testCall);
+    CPPUNIT_TEST(testIndex);
+    CPPUNIT_TEST(testAllCombinations);
+    CPPUNIT_TEST(testConstexpr);
+    CPPUNIT_TEST(testOutOfRange);
+    CPPUNIT_TEST_SUITE_END();
+public:
+    void setUp();
+    void tearDown();
+protected:
+    void testCall();
+    void testIndex();
+    void testAllCombinations();
+    void testConstexpr();
+    void testOutOfRange();
+};
+
+void TestDispatchTable::setUp()
+{}
+
+void TestDispatchTable::tearDown()
+{}
+
+void TestDispatchTable::testCall()
+{
+    std::size_t type = 1;
+    std::size_t layout = 0;
+    std::size_t simd = 2;
+
+    CPPUNIT_ASSERT("x8row8" == describe_table::call({type, layout, simd}, "x"));
+    CPPUNIT_ASSERT("4column1" == describe_table::call({0, 1, 0}, ""));
+    CPPUNIT_ASSERT((&describe_kernel::apply<double, column_major, width<4>>) == describe_table::find({1, 1, 1}));
+}
+
+void TestDispatchTable::testIndex()
+{
+    static_assert(12 == describe_table::size, "Wrong size");
+    static_assert(std::is_same<describe_table::extents, tuple_utils::index_sequence<2, 2, 3>>::value,
+                  "Type mismatch");
+    static_assert(0 == describe_table::index({0, 0, 0}), "Wrong index");
+    static_assert(5 == describe_table::index({0, 1, 2}), "Wrong index");
+    static_assert(9 == describe_table::index({1, 1, 0}), "Wrong index");
+    static_assert(11 == describe_table::index({1, 1, 2}), "Wrong index");
+    static_assert(std::is_same<tuple_utils::type_at<9, describe_table::combinations>::type,
+                               tuple_utils::type_list<double, column_major, width<1>>>::value, "Type mismatch");
+}
+
+void TestDispatchTable::testAllCombinations()
+{
+    std::string result;
+    for (std::size_t k = 0; k < describe_table::size; ++k)
+    {
+        result += describe_table::at(k)(" ");
+    }
+    CPPUNIT_ASSERT(" 4row1 4row4 4row8 4column1 4column4 4column8"
+                   " 8row1 8row4 8row8 8column1 8column4 8column8" == result);
+}
+
+void TestDispatchTable::testConstexpr()
+{
+    using table = tuple_utils::dispatch_table<int(int), add_kernel, tuple_utils::type_list<char, short, double>>;
+
+    constexpr table::pointer kernel = table::find({2});
+    static_assert(kernel == &add_kernel::apply<double>, "Wrong kernel");
+    static_assert(3 == table::size, "Wrong size");
+    CPPUNIT_ASSERT(9 == table::call({2}, 1));
+    CPPUNIT_ASSERT(2 == table::at(0)(1));
+}
+
+void TestDispatchTable::testOutOfRange()
+{
+    std::size_t layout = 2;
+
+    CPPUNIT_ASSERT_THROW(describe_table::index({0, layout, 0}), std::out_of_range);
+    CPPUNIT_ASSERT_THROW(describe_table::index({0, 0, 3}), std::out_of_range);
+    CPPUNIT_ASSERT_THROW(describe_table::find({2, 0, 0}), std::out_of_range);
+    CPPUNIT_ASSERT_THROW(describe_table::call({1, layout, 2}, "x"), std::out_of_range);
+    CPPUNIT_ASSERT_THROW(describe_table::at(describe_table::size), std::out_of_range);
+    CPPUNIT_ASSERT("8column8" == describe_table::at(describe_table::size - 1)(""));
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestDispatchTable );
+
+int main()
+{
+    CppUnit::TextUi::TestRunner runner;
+    CppUnit::TestFactoryRegistry &registry = CppUnit::TestFactoryRegistry::getRegistry();
+    runner.addTest(registry.makeTest());
+    bool wasSuccessful = runner.run("", false);
+    return wasSuccessful;
+}
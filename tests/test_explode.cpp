@@ -1,6 +1,7 @@
 #include "../src/explode.hpp"
 #include <tuple>
 #include <string>
+#include <memory>
 #include <cppunit/extensions/TestFactoryRegistry.h>
 #include <cppunit/ui/text/TestRunner.h>
 #include <cppunit/extensions/HelperMacros.h>
@@ -11,13 +12,15 @@
 class TestExplodeTuple : public CppUnit::TestFixture
 {
     CPPUNIT_TEST_SUITE(TestExplodeTuple);
-
+    CPPUNIT_TEST(testLvalueNotMoved);
+    CPPUNIT_TEST(testRvalueMoved);
     CPPUNIT_TEST_SUITE_END();
 public:
     void setUp();
     void tearDown();
 protected:
-
+    void testLvalueNotMoved();
+    void testRvalueMoved();
 };
 
 void TestExplodeTuple::setUp()
@@ -26,7 +29,30 @@ void TestExplodeTuple::setUp()
 void TestExplodeTuple::tearDown()
 {}
 
+void TestExplodeTuple::testLvalueNotMoved()
+{
+    auto arg = std::make_tuple(std::string("hello"), std::string("world"));
+    auto result = tuple_utils::explode(
+        [](std::string first, std::string second) { return first + " " + second; },
+        arg
+    );
+
+    CPPUNIT_ASSERT("hello world" == result);
+    CPPUNIT_ASSERT("hello" == std::get<0>(arg));
+    CPPUNIT_ASSERT("world" == std::get<1>(arg));
+}
+
+void TestExplodeTuple::testRvalueMoved()
+{
+    auto arg = std::make_tuple(std::unique_ptr<int>(new int(3)), 4);
+    auto result = tuple_utils::explode(
+        [](std::unique_ptr<int> ptr, int value) { return *ptr + value; },
+        std::move(arg)
+    );
 
+    CPPUNIT_ASSERT(7 == result);
+    CPPUNIT_ASSERT(nullptr == std::get<0>(arg));
+}
 
 CPPUNIT_TEST_SUITE_REGISTRATION( TestExplodeTuple );
 
@@ -0,0 +1,218 @@
+#include "../src/fold_rows.hpp"
+#include "../src/fold_tuples.hpp"
+#include "../src/soa_vector.hpp"
+#include <tuple>
+#include <string>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestCase.h>
+#include <cppunit/TestFixture.h>
+
+struct Plus
+{
+    template <class T, class U>
+    auto operator()(T&& t, U&& u) const
+    -> decltype(std::forward<T>(t) + std::forward<U>(u))
+    {
+        return std::forward<T>(t) + std::forward<U>(u);
+    }
+};
+
+struct Parenthesize
+{
+    std::string operator()(const std::string& x, const std::string& y) const
+    {
+        return "(" + x + y + ")";
+    }
+};
+
+class TestFoldRows : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestFoldRows);
+    CPPUNIT_TEST(testSums);
+    CPPUNIT_TEST(testSameAsFold);
+    CPPUNIT_TEST(testOrder);
+    CPPUNIT_TEST(testResultType);
+    CPPUNIT_TEST(testOneRow);
+    CPPUNIT_TEST(testEmpty);
+    CPPUNIT_TEST(testRvalueRows);
+    CPPUNIT_TEST(testSoaVector);
+    CPPUNIT_TEST(testStatefulFunctor);
+    CPPUNIT_TEST_SUITE_END();
+public:
+    void setUp();
+    void tearDown();
+protected:
+    void testSums();
+    void testSameAsFold();
+    void testOrder();
+    void testResultType();
+    void testOneRow();
+    void testEmpty();
+    void testRvalueRows();
+    void testSoaVector();
+    void testStatefulFunctor();
+};
+
+void TestFoldRows::setUp()
+{}
+
+void TestFoldRows::tearDown()
+{}
+
+void TestFoldRows::testSums()
+{
+    std::vector<std::tuple<int, double, long>> rows;
+    for (int i = 1; i <= 100; ++i)
+    {
+        rows.push_back(std::make_tuple(i, 0.5 * i, -2L * i));
+    }
+
+    CPPUNIT_ASSERT(std::make_tuple(5050, 2525.0, -10100L) == tuple_utils::fold_rows(Plus(), rows));
+}
+
+void TestFoldRows::testSameAsFold()
+{
+    auto r0 = std::make_tuple(10, std::string("a"));
+    auto r1 = std::make_tuple(3, std::string("b"));
+    auto r2 = std::make_tuple(2, std::string("c"));
+    auto minus = [](int x, int y) { return x - y; };
+    std::vector<std::tuple<int, std::string>> rows {r0, r1, r2};
+    std::vector<std::tuple<int>> numbers {std::make_tuple(10), std::make_tuple(3), std::make_tuple(2)};
+
+    CPPUNIT_ASSERT(tuple_utils::fold(Plus(), r0, r1, r2) == tuple_utils::fold_rows(Plus(), rows));
+    //10 - (3 - 2), the same order as fold
+    CPPUNIT_ASSERT(std::make_tuple(9) == tuple_utils::fold_rows(minus, numbers));
+    CPPUNIT_ASSERT(tuple_utils::fold(minus, numbers[0], numbers[1], numbers[2]) == tuple_utils::fold_rows(minus, numbers));
+}
+
+void TestFoldRows::testOrder()
+{
+    std::vector<std::tuple<std::string>> rows {
+        std::make_tuple(std::string("a")), std::make_tuple(std::string("b")),
+        std::make_tuple(std::string("c")), std::make_tuple(std::string("d"))
+    };
+
+    CPPUNIT_ASSERT("(a(b(cd)))" == std::get<0>(tuple_utils::fold_rows(Parenthesize(), rows)));
+}
+
+void TestFoldRows::testResultType()
+{
+    std::vector<std::tuple<short, char, float>> rows {std::make_tuple(short(1), 'a', 0.5f)};
+    auto result = tuple_utils::fold_rows(Plus(), rows);
+
+    static_assert(std::is_same<std::tuple<int, int, float>, decltype(result)>::value, "Type mismatch");
+    CPPUNIT_ASSERT(std::make_tuple(1, 'a', 0.5f) == result);
+}
+
+void TestFoldRows::testOneRow()
+{
+    std::vector<std::tuple<std::string, int>> rows {std::make_tuple(std::string("x"), 7)};
+
+    std::vector<std::tuple<std::string>> strings {std::make_tuple(std::string("x"))};
+
+    CPPUNIT_ASSERT(std::make_tuple(std::string("x"), 7) == tuple_utils::fold_rows(Plus(), rows));
+    //f is not called for a single row
+    CPPUNIT_ASSERT("x" == std::get<0>(tuple_utils::fold_rows(Parenthesize(), strings)));
+}
+
+void TestFoldRows::testEmpty()
+{
+    std::vector<std::tuple<int, double>> rows;
+
+    CPPUNIT_ASSERT_THROW(tuple_utils::fold_rows(Plus(), rows), std::invalid_argument);
+}
+
+struct PtrPlus
+{
+    std::unique_ptr<int> operator()(std::unique_ptr<int> x, std::unique_ptr<int> y) const
+    {
+        return std::unique_ptr<int>(new int(*x + *y));
+    }
+
+    int operator()(int x, int y) const
+    {
+        return x + y;
+    }
+};
+
+void TestFoldRows::testRvalueRows()
+{
+    std::vector<std::tuple<std::unique_ptr<int>, int>> rows;
+    for (int i = 1; i <= 3; ++i)
+    {
+        rows.push_back(std::make_tuple(std::unique_ptr<int>(new int(i)), i));
+    }
+    auto result = tuple_utils::fold_rows(PtrPlus(), std::move(rows));
+
+    CPPUNIT_ASSERT(6 == *std::get<0>(result));
+    CPPUNIT_ASSERT(6 == std::get<1>(result));
+    //elements of rvalue rows are moved into f
+    CPPUNIT_ASSERT(!std::get<0>(rows[0]) && !std::get<0>(rows[1]) && !std::get<0>(rows[2]));
+}
+
+void TestFoldRows::testSoaVector()
+{
+    tuple_utils::soa_vector<int, float, std::string> values;
+    values.emplace_back(1, 0.5f, std::string("a"));
+    values.emplace_back(2, 1.5f, std::string("b"));
+    values.emplace_back(3, 2.0f, std::string("c"));
+    auto result = tuple_utils::fold_rows(Plus(), values);
+
+    static_assert(std::is_same<std::tuple<int, float, std::string>, decltype(result)>::value, "Type mismatch");
+    CPPUNIT_ASSERT(std::make_tuple(6, 4.0f, std::string("abc")) == result);
+    CPPUNIT_ASSERT(tuple_utils::fold_rows(Plus(), values.rows()) == result);
+}
+
+/**
+ * Counts its calls in a non-const operator(), could not be copied
+ */
+struct CountingPlus
+{
+    CountingPlus() = default;
+    CountingPlus(const CountingPlus&) = delete;
+
+    int operator()(int x, int y)
+    {
+        ++calls;
+        return x + y;
+    }
+
+    int calls = 0;
+};
+
+void TestFoldRows::testStatefulFunctor()
+{
+    auto r0 = std::make_tuple(1, 2);
+    auto r1 = std::make_tuple(3, 4);
+    auto r2 = std::make_tuple(5, 6);
+    std::vector<std::tuple<int, int>> rows {r0, r1, r2};
+    tuple_utils::soa_vector<int, int> values;
+    values.emplace_back(1, 2);
+    values.emplace_back(3, 4);
+    values.emplace_back(5, 6);
+    CountingPlus folded, rowsFolded, soaFolded;
+
+    CPPUNIT_ASSERT(tuple_utils::fold(folded, r0, r1, r2) == tuple_utils::fold_rows(rowsFolded, rows));
+    CPPUNIT_ASSERT(tuple_utils::fold_rows(rowsFolded, rows) == tuple_utils::fold_rows(soaFolded, values));
+    //all calls are made on the given functor, as for fold
+    CPPUNIT_ASSERT(4 == folded.calls);
+    CPPUNIT_ASSERT(8 == rowsFolded.calls);
+    CPPUNIT_ASSERT(4 == soaFolded.calls);
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestFoldRows );
+
+int main()
+{
+    CppUnit::TextUi::TestRunner runner;
+    CppUnit::TestFactoryRegistry &registry = CppUnit::TestFactoryRegistry::getRegistry();
+    runner.addTest(registry.makeTest());
+    bool wasSuccessful = runner.run("", false);
+    return wasSuccessful;
+}
@@ -3,6 +3,9 @@
 #include <string>
 #include <limits>
 #include <cmath>
+#include <memory>
+#include <vector>
+#include <type_traits>
 #include <cppunit/extensions/TestFactoryRegistry.h>
 #include <cppunit/ui/text/TestRunner.h>
 #include <cppunit/extensions/HelperMacros.h>
@@ -44,6 +47,27 @@ class TestFoldTuple : public CppUnit::TestFixture
     CPPUNIT_TEST(testFirstSmaller);
     CPPUNIT_TEST(testLastSmaller);
     CPPUNIT_TEST(testSmallerInMid);
+    CPPUNIT_TEST(testMoveOnly);
+    CPPUNIT_TEST(testLvalueNotMoved);
+    CPPUNIT_TEST(testOrderShapes);
+    CPPUNIT_TEST(testFoldLeft);
+    CPPUNIT_TEST(testFoldLeftTypes);
+    CPPUNIT_TEST(testFoldLeftByReference);
+    CPPUNIT_TEST(testFoldTree);
+    CPPUNIT_TEST(testFoldTreeTypes);
+    CPPUNIT_TEST(testFoldTreeMoveOnly);
+    CPPUNIT_TEST(testUnaryOrders);
+    CPPUNIT_TEST(testNotDefaultConstructible);
+    CPPUNIT_TEST(testAccumulate);
+    CPPUNIT_TEST(testAccumulateOneTuple);
+    CPPUNIT_TEST(testAccumulateMoveOnly);
+    CPPUNIT_TEST(testInclusiveScan);
+    CPPUNIT_TEST(testInclusiveScanInit);
+    CPPUNIT_TEST(testExclusiveScan);
+    CPPUNIT_TEST(testScanEmpty);
+    CPPUNIT_TEST(testScanOneElement);
+    CPPUNIT_TEST(testScanRvalues);
+    CPPUNIT_TEST(testScanConstexpr);
     CPPUNIT_TEST_SUITE_END();
 public:
     void setUp();
@@ -69,6 +93,27 @@ protected:
     void testFirstSmaller();
     void testLastSmaller();
     void testSmallerInMid();
+    void testMoveOnly();
+    void testLvalueNotMoved();
+    void testOrderShapes();
+    void testFoldLeft();
+    void testFoldLeftTypes();
+    void testFoldLeftByReference();
+    void testFoldTree();
+    void testFoldTreeTypes();
+    void testFoldTreeMoveOnly();
+    void testUnaryOrders();
+    void testNotDefaultConstructible();
+    void testAccumulate();
+    void testAccumulateOneTuple();
+    void testAccumulateMoveOnly();
+    void testInclusiveScan();
+    void testInclusiveScanInit();
+    void testExclusiveScan();
+    void testScanEmpty();
+    void testScanOneElement();
+    void testScanRvalues();
+    void testScanConstexpr();
 };
 
 void TestFoldTuple::setUp()
@@ -393,6 +438,339 @@ void TestFoldTuple::testSmallerInMid()
     CPPUNIT_ASSERT(10 == std::get<0>(result));
 }
 
+struct PtrPlus
+{
+    std::unique_ptr<int> operator()(std::unique_ptr<int> x, std::unique_ptr<int> y) const
+    {
+        return std::unique_ptr<int>(new int(*x + *y));
+    }
+};
+
+void TestFoldTuple::testMoveOnly()
+{
+    auto result = tuple_utils::fold(
+        PtrPlus(),
+        std::make_tuple(std::unique_ptr<int>(new int(1)), std::unique_ptr<int>(new int(2))),
+        std::make_tuple(std::unique_ptr<int>(new int(10)), std::unique_ptr<int>(new int(20))),
+        std::make_tuple(std::unique_ptr<int>(new int(100)), std::unique_ptr<int>(new int(200)))
+    );
+
+    static_assert(
+        std::is_same<std::tuple<std::unique_ptr<int>, std::unique_ptr<int>>, decltype(result)>::value,
+        "Type mismatch"
+    );
+    CPPUNIT_ASSERT(111 == *std::get<0>(result));
+    CPPUNIT_ASSERT(222 == *std::get<1>(result));
+}
+
+void TestFoldTuple::testLvalueNotMoved()
+{
+    auto arg1 = std::make_tuple(std::string("a"), std::string("b"));
+    auto arg2 = std::make_tuple(std::string("c"), std::string("d"));
+    auto result = tuple_utils::fold([](std::string x, std::string y){ return x + y;}, arg1, std::move(arg2));
+
+    CPPUNIT_ASSERT(std::make_tuple(std::string("ac"), std::string("bd")) == result);
+    CPPUNIT_ASSERT(std::make_tuple(std::string("a"), std::string("b")) == arg1);
+}
+
+struct Parenthesize
+{
+    std::string operator()(const std::string& x, const std::string& y) const
+    {
+        return "(" + x + y + ")";
+    }
+};
+
+void TestFoldTuple::testOrderShapes()
+{
+    auto a = std::make_tuple(std::string("a"));
+    auto b = std::make_tuple(std::string("b"));
+    auto c = std::make_tuple(std::string("c"));
+    auto d = std::make_tuple(std::string("d"));
+    auto e = std::make_tuple(std::string("e"));
+
+    CPPUNIT_ASSERT("(a(b(cd)))" == std::get<0>(tuple_utils::fold(Parenthesize(), a, b, c, d)));
+    CPPUNIT_ASSERT("(((ab)c)d)" == std::get<0>(tuple_utils::fold_left(Parenthesize(), a, b, c, d)));
+    CPPUNIT_ASSERT("((ab)(cd))" == std::get<0>(tuple_utils::fold_tree(Parenthesize(), a, b, c, d)));
+    CPPUNIT_ASSERT("(a(bc))" == std::get<0>(tuple_utils::fold_tree(Parenthesize(), a, b, c)));
+    CPPUNIT_ASSERT("((ab)(c(de)))" == std::get<0>(tuple_utils::fold_tree(Parenthesize(), a, b, c, d, e)));
+    CPPUNIT_ASSERT("(ab)" == std::get<0>(tuple_utils::fold_left(Parenthesize(), a, b)));
+    CPPUNIT_ASSERT("(ab)" == std::get<0>(tuple_utils::fold_tree(Parenthesize(), a, b)));
+}
+
+void TestFoldTuple::testFoldLeft()
+{
+    auto result = tuple_utils::fold_left(
+        [](int x, int y) { return x - y; },
+        std::make_tuple(10, 1),
+        std::make_tuple(3, 2),
+        std::make_tuple(2, 3)
+    );
+
+    static_assert(std::is_same<std::tuple<int, int>, decltype(result)>::value, "Type mismatch");
+    CPPUNIT_ASSERT(std::make_tuple(5, -4) == result);
+}
+
+struct Append
+{
+    std::string operator()(std::string s, char c) const
+    {
+        return s + c;
+    }
+};
+
+void TestFoldTuple::testFoldLeftTypes()
+{
+    //only the left fold could be used, the accumulated string is always the first argument
+    auto result = tuple_utils::fold_left(
+        Append(),
+        std::make_tuple(std::string("x"), std::string("y")),
+        std::make_tuple('a', 'b'),
+        std::make_tuple('c', 'd')
+    );
+
+    static_assert(std::is_same<tuple_utils::result_of_left<Append, std::string, char, char>::type, std::string>::value,
+                  "Type mismatch");
+    CPPUNIT_ASSERT(std::make_tuple(std::string("xac"), std::string("ybd")) == result);
+}
+
+void TestFoldTuple::testFoldLeftByReference()
+{
+    std::tuple<short, double> arg1 {2, 2.2};
+    std::tuple<int, float> arg2 {1, 1.1};
+    std::tuple<int, double> arg3 {4, 0.3};
+    auto result = tuple_utils::fold_left(FunctorByReference(), arg1, arg2, arg3);
+
+    static_assert(std::is_same<std::tuple_element<0, decltype(result)>::type, int>::value, "Type mismatch");
+    static_assert(std::is_same<std::tuple_element<1, decltype(result)>::type, double>::value, "Type mismatch");
+    CPPUNIT_ASSERT(8 == std::get<0>(result));
+    CPPUNIT_ASSERT(std::abs(0.726 - std::get<1>(result)) < std::numeric_limits<float>::epsilon());
+}
+
+void TestFoldTuple::testFoldTree()
+{
+    std::tuple<int, double> arg1 {1, 0.5};
+    std::tuple<int, double> arg2 {2, 0.25};
+    std::tuple<int, double> arg3 {3, 0.125};
+    std::tuple<int, double> arg4 {4, 1};
+    std::tuple<int, double> arg5 {5, 2};
+    auto result = tuple_utils::fold_tree(t_plus(), arg1, arg2, arg3, arg4, arg5);
+
+    CPPUNIT_ASSERT(std::make_tuple(15, 3.875) == result);
+    CPPUNIT_ASSERT(tuple_utils::fold(t_plus(), arg1, arg2, arg3, arg4, arg5) == result);
+}
+
+void TestFoldTuple::testFoldTreeTypes()
+{
+    using tree = tuple_utils::result_of_tree<t_plus, short, short, int, long>::type;
+    using left = tuple_utils::result_of_left<t_plus, short, short, int, long>::type;
+
+    static_assert(std::is_same<tree, long>::value, "Type mismatch");
+    static_assert(std::is_same<left, long>::value, "Type mismatch");
+    static_assert(std::is_same<tuple_utils::result_of_tree<t_plus, short, char>::type, int>::value, "Type mismatch");
+
+    auto result = tuple_utils::fold_tree(t_plus(), std::make_tuple('a'), std::make_tuple(1), std::make_tuple(2.5));
+    static_assert(std::is_same<std::tuple<double>, decltype(result)>::value, "Type mismatch");
+    CPPUNIT_ASSERT(std::make_tuple(100.5) == result);
+}
+
+void TestFoldTuple::testFoldTreeMoveOnly()
+{
+    auto result = tuple_utils::fold_tree(
+        PtrPlus(),
+        std::make_tuple(std::unique_ptr<int>(new int(1))),
+        std::make_tuple(std::unique_ptr<int>(new int(10))),
+        std::make_tuple(std::unique_ptr<int>(new int(100))),
+        std::make_tuple(std::unique_ptr<int>(new int(1000)))
+    );
+    auto left = tuple_utils::fold_left(
+        PtrPlus(),
+        std::make_tuple(std::unique_ptr<int>(new int(1))),
+        std::make_tuple(std::unique_ptr<int>(new int(10))),
+        std::make_tuple(std::unique_ptr<int>(new int(100)))
+    );
+
+    CPPUNIT_ASSERT(1111 == *std::get<0>(result));
+    CPPUNIT_ASSERT(111 == *std::get<0>(left));
+}
+
+void TestFoldTuple::testUnaryOrders()
+{
+    auto negate = [](int x) { return -x; };
+
+    CPPUNIT_ASSERT(std::make_tuple(-1, -2) == tuple_utils::fold_left(negate, std::make_tuple(1, 2)));
+    CPPUNIT_ASSERT(std::make_tuple(-1, -2) == tuple_utils::fold_tree(negate, std::make_tuple(1, 2)));
+}
+
+struct Length
+{
+    explicit Length(std::size_t v) : value(v) {}
+    std::size_t value;
+};
+
+struct AddLength
+{
+    Length operator()(const std::string& x, const std::string& y) const
+    {
+        return Length(x.size() + y.size());
+    }
+
+    Length operator()(const std::string& x, Length y) const
+    {
+        return Length(x.size() + y.value);
+    }
+};
+
+void TestFoldTuple::testNotDefaultConstructible()
+{
+    static_assert(!std::is_default_constructible<Length>::value, "Length should not be default constructible");
+    auto result = tuple_utils::fold(AddLength(), std::make_tuple(std::string("a")), std::make_tuple(std::string("bc")),
+                                    std::make_tuple(std::string("def")));
+
+    static_assert(std::is_same<std::tuple<Length>, decltype(result)>::value, "Type mismatch");
+    CPPUNIT_ASSERT(6 == std::get<0>(result).value);
+}
+
+struct PlusAssign
+{
+    template <class T, class U>
+    void operator()(T& acc, const U& x) const
+    {
+        acc += x;
+    }
+};
+
+void TestFoldTuple::testAccumulate()
+{
+    auto arg1 = std::make_tuple(std::string("x"), 1, 0.5);
+    auto arg2 = std::make_tuple(std::string("a"), 2L, 1);
+    auto result = tuple_utils::fold_accumulate(PlusAssign(), arg1, arg2, std::make_tuple("b", 3, 2.0, 7));
+
+    static_assert(std::is_same<std::tuple<std::string, int, double>, decltype(result)>::value, "Type mismatch");
+    CPPUNIT_ASSERT(std::make_tuple(std::string("xab"), 6, 3.5) == result);
+    CPPUNIT_ASSERT(std::make_tuple(std::string("x"), 1, 0.5) == arg1);
+}
+
+void TestFoldTuple::testAccumulateOneTuple()
+{
+    auto result = tuple_utils::fold_accumulate(PlusAssign(), std::make_tuple(std::string("a"), 2));
+
+    CPPUNIT_ASSERT(std::make_tuple(std::string("a"), 2) == result);
+}
+
+struct AppendPtr
+{
+    void operator()(std::vector<std::unique_ptr<int>>& acc, std::vector<std::unique_ptr<int>>&& x) const
+    {
+        for (auto& p : x)
+        {
+            acc.push_back(std::move(p));
+        }
+    }
+};
+
+void TestFoldTuple::testAccumulateMoveOnly()
+{
+    std::vector<std::unique_ptr<int>> first, second;
+    first.push_back(std::unique_ptr<int>(new int(1)));
+    second.push_back(std::unique_ptr<int>(new int(2)));
+    const int* data = first.data()->get();
+    auto result = tuple_utils::fold_accumulate(AppendPtr(), std::make_tuple(std::move(first)),
+                                               std::make_tuple(std::move(second)));
+
+    CPPUNIT_ASSERT(2 == std::get<0>(result).size());
+    CPPUNIT_ASSERT(data == std::get<0>(result)[0].get());
+    CPPUNIT_ASSERT(2 == *std::get<0>(result)[1]);
+}
+
+void TestFoldTuple::testInclusiveScan()
+{
+    auto t = std::make_tuple(1, 2L, 0.5);
+    auto result = tuple_utils::inclusive_scan(t_plus(), t);
+
+    static_assert(std::is_same<std::tuple<int, long, double>, decltype(result)>::value, "Type mismatch");
+    CPPUNIT_ASSERT(std::make_tuple(1, 3L, 3.5) == result);
+    CPPUNIT_ASSERT(std::make_tuple(std::string("a"), std::string("(ab)"), std::string("((ab)c)")) ==
+                   tuple_utils::inclusive_scan(Parenthesize(), std::make_tuple("a", "b", "c")));
+}
+
+void TestFoldTuple::testInclusiveScanInit()
+{
+    auto result = tuple_utils::inclusive_scan(t_plus(), std::make_tuple("a", "b"), std::string(">"));
+
+    static_assert(std::is_same<std::tuple<std::string, std::string>, decltype(result)>::value, "Type mismatch");
+    CPPUNIT_ASSERT(std::make_tuple(std::string(">a"), std::string(">ab")) == result);
+}
+
+void TestFoldTuple::testExclusiveScan()
+{
+    auto sizes = std::make_tuple(sizeof(int), sizeof(double), sizeof(char));
+    auto offsets = tuple_utils::exclusive_scan(t_plus(), sizes, std::size_t(0));
+
+    static_assert(std::is_same<std::tuple<std::size_t, std::size_t, std::size_t>, decltype(offsets)>::value,
+                  "Type mismatch");
+    CPPUNIT_ASSERT(std::make_tuple(std::size_t(0), sizeof(int), sizeof(int) + sizeof(double)) == offsets);
+    CPPUNIT_ASSERT(std::make_tuple(std::string("x"), std::string("(xa)"), std::string("((xa)b)")) ==
+                   tuple_utils::exclusive_scan(Parenthesize(), std::make_tuple("a", "b", "c"), std::string("x")));
+}
+
+void TestFoldTuple::testScanEmpty()
+{
+    static_assert(std::is_same<std::tuple<>,
+                               decltype(tuple_utils::inclusive_scan(t_plus(), std::tuple<>()))>::value,
+                  "Type mismatch");
+    static_assert(std::is_same<std::tuple<>,
+                               decltype(tuple_utils::inclusive_scan(t_plus(), std::tuple<>(), 1))>::value,
+                  "Type mismatch");
+    static_assert(std::is_same<std::tuple<>,
+                               decltype(tuple_utils::exclusive_scan(t_plus(), std::tuple<>(), 1))>::value,
+                  "Type mismatch");
+    CPPUNIT_ASSERT(std::tuple<>() == tuple_utils::exclusive_scan(t_plus(), std::tuple<>(), 1));
+}
+
+void TestFoldTuple::testScanOneElement()
+{
+    CPPUNIT_ASSERT(std::make_tuple(2) == tuple_utils::inclusive_scan(t_plus(), std::make_tuple(2)));
+    CPPUNIT_ASSERT(std::make_tuple(3) == tuple_utils::inclusive_scan(t_plus(), std::make_tuple(2), 1));
+    CPPUNIT_ASSERT(std::make_tuple(1) == tuple_utils::exclusive_scan(t_plus(), std::make_tuple(2), 1));
+}
+
+void TestFoldTuple::testScanRvalues()
+{
+    auto t = std::make_tuple(std::string("a"), std::string("b"));
+    auto result = tuple_utils::inclusive_scan(
+                [](const std::string& acc, std::string x) { return acc + x; },
+                std::move(t)
+            );
+
+    CPPUNIT_ASSERT(std::make_tuple(std::string("a"), std::string("ab")) == result);
+    //each element is read once, so all of them are moved
+    CPPUNIT_ASSERT(std::get<0>(t).empty() && std::get<1>(t).empty());
+}
+
+struct ConstexprPlus
+{
+    template <class T, class U>
+    constexpr auto operator()(const T& t, const U& u) const -> decltype(t + u)
+    {
+        return t + u;
+    }
+};
+
+void TestFoldTuple::testScanConstexpr()
+{
+#if __cplusplus >= 201402L
+    constexpr auto offsets = tuple_utils::exclusive_scan(ConstexprPlus(), std::make_tuple(4, 8, 2), 0);
+    static_assert(std::get<0>(offsets) == 0 && std::get<1>(offsets) == 4 && std::get<2>(offsets) == 12,
+                  "Not scanned at compile time");
+    static_assert(std::get<2>(tuple_utils::inclusive_scan(ConstexprPlus(), std::make_tuple(1, 2L, 3))) == 6L,
+                  "Not scanned at compile time");
+    CPPUNIT_ASSERT(std::make_tuple(0, 4, 12) == offsets);
+#else
+    CPPUNIT_ASSERT(std::make_tuple(0, 4, 12) == tuple_utils::exclusive_scan(ConstexprPlus(), std::make_tuple(4, 8, 2), 0));
+#endif
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION( TestFoldTuple );
 
 int main()
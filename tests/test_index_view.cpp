@@ -0,0 +1,241 @@
+#include "../src/index_view.hpp"
+#include "../src/explode.hpp"
+#include "../src/merge_tuples.hpp"
+#include "../src/make_custom_tuple.hpp"
+#include "../src/reverse.hpp"
+#include <tuple>
+#include <string>
+#include <memory>
+#include <type_traits>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestCase.h>
+#include <cppunit/TestFixture.h>
+
+class TestIndexView : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestIndexView);
+    CPPUNIT_TEST(testMakeIndexView);
+    CPPUNIT_TEST(testPipeline);
+    CPPUNIT_TEST(testPipelineOnTuple);
+    CPPUNIT_TEST(testMergeMany);
+    CPPUNIT_TEST(testReferences);
+    CPPUNIT_TEST(testConstTuple);
+    CPPUNIT_TEST(testTupleTraits);
+    CPPUNIT_TEST(testExplode);
+    CPPUNIT_TEST(testMaterializeMove);
+    CPPUNIT_TEST(testRepeatedIndex);
+    CPPUNIT_TEST(testLvalueView);
+    CPPUNIT_TEST(testRvalueTuple);
+    CPPUNIT_TEST_SUITE_END();
+public:
+    void setUp();
+    void tearDown();
+protected:
+    void testMakeIndexView();
+    void testPipeline();
+    void testPipelineOnTuple();
+    void testMergeMany();
+    void testReferences();
+    void testConstTuple();
+    void testTupleTraits();
+    void testExplode();
+    void testMaterializeMove();
+    void testRepeatedIndex();
+    void testLvalueView();
+    void testRvalueTuple();
+};
+
+void TestIndexView::setUp()
+{}
+
+void TestIndexView::tearDown()
+{}
+
+void TestIndexView::testMakeIndexView()
+{
+    auto t1 = std::make_tuple(1, 2.5);
+    auto t2 = std::make_tuple(std::string("x"));
+    auto view = tuple_utils::make_index_view(t1, t2);
+
+    CPPUNIT_ASSERT(1 == tuple_utils::get<0>(view));
+    CPPUNIT_ASSERT(2.5 == tuple_utils::get<1>(view));
+    CPPUNIT_ASSERT("x" == tuple_utils::get<2>(view));
+    CPPUNIT_ASSERT(tuple_utils::merge(t1, t2) == tuple_utils::materialize(view));
+}
+
+void TestIndexView::testPipeline()
+{
+    auto t1 = std::make_tuple(1, 2.5, 'c');
+    auto t2 = std::make_tuple(std::string("x"), 7L);
+
+    auto eager = tuple_utils::reverse(tuple_utils::make_custom_tuple<4, 0, 3, 1>(tuple_utils::merge(t1, t2)));
+    auto fused = tuple_utils::materialize(
+                tuple_utils::view_reverse(tuple_utils::view_pick<4, 0, 3, 1>(tuple_utils::view_merge(t1, t2)))
+            );
+
+    static_assert(std::is_same<decltype(eager), decltype(fused)>::value, "Type mismatch");
+    CPPUNIT_ASSERT(eager == fused);
+    CPPUNIT_ASSERT(std::make_tuple(2.5, std::string("x"), 1, 7L) == fused);
+}
+
+void TestIndexView::testPipelineOnTuple()
+{
+    auto t = std::make_tuple(1, 2, 3);
+    auto view = tuple_utils::view_pick(tuple_utils::view_reverse(t), tuple_utils::index_sequence<0, 0, 2>());
+
+    CPPUNIT_ASSERT(std::make_tuple(3, 3, 1) == tuple_utils::materialize(view));
+    CPPUNIT_ASSERT(&std::get<2>(t) == &tuple_utils::get<1>(view));
+}
+
+void TestIndexView::testMergeMany()
+{
+    auto t1 = std::make_tuple(1);
+    auto t2 = std::make_tuple(2, 3);
+    auto t3 = std::tuple<>();
+    auto t4 = std::make_tuple(4);
+
+    auto view = tuple_utils::view_merge(tuple_utils::view_reverse(t2), t1, t3, tuple_utils::view_pick<0, 0>(t4));
+
+    CPPUNIT_ASSERT(std::make_tuple(3, 2, 1, 4, 4) == tuple_utils::materialize(view));
+    CPPUNIT_ASSERT(std::make_tuple(1, 2, 3, 4) == tuple_utils::materialize(tuple_utils::view_merge(t1, t2, t3, t4)));
+}
+
+void TestIndexView::testReferences()
+{
+    auto t1 = std::make_tuple(1, 2);
+    auto t2 = std::make_tuple(3);
+    auto view = tuple_utils::view_reverse(tuple_utils::view_merge(t1, t2));
+
+    tuple_utils::get<0>(view) = 30;
+    tuple_utils::get<2>(view) = 10;
+
+    CPPUNIT_ASSERT(std::make_tuple(10, 2) == t1);
+    CPPUNIT_ASSERT(std::make_tuple(30) == t2);
+}
+
+void TestIndexView::testConstTuple()
+{
+    const auto t1 = std::make_tuple(1, 2);
+    auto t2 = std::make_tuple(3);
+    auto view = tuple_utils::view_merge(t2, t1);
+
+    static_assert(std::is_same<decltype(tuple_utils::get<1>(view)), const int&>::value, "Type mismatch");
+    static_assert(std::is_same<decltype(tuple_utils::get<0>(view)), int&>::value, "Type mismatch");
+    static_assert(std::is_same<decltype(tuple_utils::materialize(view)), std::tuple<int, int, int>>::value,
+                  "Type mismatch");
+    CPPUNIT_ASSERT(std::make_tuple(3, 1, 2) == tuple_utils::materialize(view));
+}
+
+void TestIndexView::testTupleTraits()
+{
+    auto t1 = std::make_tuple(1, 2.5);
+    auto t2 = std::make_tuple('c');
+    using view = decltype(tuple_utils::view_pick<2, 1>(tuple_utils::view_merge(t1, t2)));
+
+    static_assert(std::tuple_size<view>::value == 2, "Wrong size");
+    static_assert(std::is_same<std::tuple_element<0, view>::type, char>::value, "Type mismatch");
+    static_assert(std::is_same<std::tuple_element<1, view>::type, double>::value, "Type mismatch");
+    static_assert(std::is_same<tuple_utils::to_type_list<view>::type, tuple_utils::type_list<char, double>>::value,
+                  "Type mismatch");
+    static_assert(std::is_same<view::source, tuple_utils::index_sequence<1, 0>>::value, "Type mismatch");
+    static_assert(std::is_same<view::offset, tuple_utils::index_sequence<0, 1>>::value, "Type mismatch");
+    CPPUNIT_ASSERT(2 == std::tuple_size<view>::value);
+}
+
+void TestIndexView::testExplode()
+{
+    auto t1 = std::make_tuple(1, 2);
+    auto t2 = std::make_tuple(std::string("a"));
+    auto result = tuple_utils::explode(
+                [](const std::string& s, int x, int y) { return s + std::to_string(x) + std::to_string(y); },
+                tuple_utils::view_reverse(tuple_utils::view_merge(t1, t2))
+            );
+
+    CPPUNIT_ASSERT("a21" == result);
+}
+
+void TestIndexView::testMaterializeMove()
+{
+    auto t1 = std::make_tuple(std::unique_ptr<int>(new int(1)), std::string("a"));
+    auto t2 = std::make_tuple(std::unique_ptr<int>(new int(2)));
+    auto result = tuple_utils::materialize(
+                tuple_utils::view_reverse(tuple_utils::view_merge(std::move(t1), std::move(t2)))
+            );
+
+    static_assert(std::is_same<decltype(result),
+                               std::tuple<std::unique_ptr<int>, std::string, std::unique_ptr<int>>>::value,
+                  "Type mismatch");
+    CPPUNIT_ASSERT(2 == *std::get<0>(result));
+    CPPUNIT_ASSERT("a" == std::get<1>(result));
+    CPPUNIT_ASSERT(1 == *std::get<2>(result));
+    CPPUNIT_ASSERT(!std::get<0>(t1) && !std::get<0>(t2));
+}
+
+void TestIndexView::testRepeatedIndex()
+{
+    auto view = tuple_utils::view_pick<0, 1, 0>(std::make_tuple(std::string("abc"), std::string("d")));
+    auto result = tuple_utils::materialize(std::move(view));
+
+    //the first element is used twice, so it is copied, the second one is moved
+    CPPUNIT_ASSERT(std::make_tuple(std::string("abc"), std::string("d"), std::string("abc")) == result);
+    CPPUNIT_ASSERT("abc" == std::get<0>(tuple_utils::details::kept_get(std::get<0>(view.tuples))));
+}
+
+void TestIndexView::testLvalueView()
+{
+    auto t1 = std::make_tuple(1, 2);
+    auto t2 = std::make_tuple(3);
+    auto merged = tuple_utils::view_merge(t1, t2);
+    auto reversed = tuple_utils::view_reverse(merged);
+    auto picked = tuple_utils::view_pick<0, 2>(merged);
+
+    CPPUNIT_ASSERT(std::make_tuple(3, 2, 1) == tuple_utils::materialize(reversed));
+    CPPUNIT_ASSERT(std::make_tuple(1, 3) == tuple_utils::materialize(picked));
+    CPPUNIT_ASSERT(&std::get<0>(t2) == &tuple_utils::get<0>(reversed));
+}
+
+void TestIndexView::testRvalueTuple()
+{
+    std::tuple<int> arg1 {1};
+    auto view = tuple_utils::view_reverse(tuple_utils::view_merge(arg1, std::make_tuple(std::string("kept"), 2)));
+
+    //rvalue tuple is moved into the view, lvalue tuple is only referenced
+    static_assert(std::is_same<decltype(view.tuples), std::tuple<
+                      std::tuple<int>&, tuple_utils::details::kept_box<std::tuple<std::string, int>>
+                  >>::value, "Type mismatch");
+    static_assert(std::is_same<const std::string&, decltype(tuple_utils::get<1>(view))>::value, "Type mismatch");
+    CPPUNIT_ASSERT(&arg1 == &std::get<0>(view.tuples));
+    CPPUNIT_ASSERT(&std::get<0>(std::get<1>(view.tuples).get()) == &tuple_utils::get<1>(view));
+
+    //copy of the view keeps its own copy of the rvalue tuple
+    auto copy = view;
+    CPPUNIT_ASSERT(&tuple_utils::get<1>(copy) != &tuple_utils::get<1>(view));
+    CPPUNIT_ASSERT(&tuple_utils::get<2>(copy) == &std::get<0>(arg1));
+    CPPUNIT_ASSERT(tuple_utils::materialize(view) == tuple_utils::materialize(copy));
+    CPPUNIT_ASSERT(std::make_tuple(2, std::string("kept"), 1) == tuple_utils::materialize(view));
+
+    //lvalue view lends the tuple it keeps to views created from it
+    auto picked = tuple_utils::view_pick<1>(view);
+    static_assert(std::is_same<decltype(picked.tuples), std::tuple<std::tuple<int>&, std::tuple<std::string, int>&>>::value,
+                  "Type mismatch");
+    CPPUNIT_ASSERT(&tuple_utils::get<1>(view) == &tuple_utils::get<0>(picked));
+
+    //rvalue view hands the tuple over, its elements are not moved
+    const std::string* kept = &tuple_utils::get<1>(view);
+    auto reversed = tuple_utils::view_reverse(std::move(view));
+    CPPUNIT_ASSERT(kept == &tuple_utils::get<1>(reversed));
+    CPPUNIT_ASSERT(std::make_tuple(1, std::string("kept"), 2) == tuple_utils::materialize(std::move(reversed)));
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestIndexView );
+
+int main()
+{
+    CppUnit::TextUi::TestRunner runner;
+    CppUnit::TestFactoryRegistry &registry = CppUnit::TestFactoryRegistry::getRegistry();
+    runner.addTest(registry.makeTest());
+    bool wasSuccessful = runner.run("", false);
+    return wasSuccessful;
+}
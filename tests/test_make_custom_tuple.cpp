@@ -1,6 +1,8 @@
 #include "../src/make_custom_tuple.hpp"
 #include <tuple>
 #include <string>
+#include <memory>
+#include <type_traits>
 #include <cppunit/extensions/TestFactoryRegistry.h>
 #include <cppunit/ui/text/TestRunner.h>
 #include <cppunit/extensions/HelperMacros.h>
@@ -17,6 +19,9 @@ class TestMakeCustomTuple : public CppUnit::TestFixture
     CPPUNIT_TEST(testVariousCreation);
     CPPUNIT_TEST(testNullCreation);
     CPPUNIT_TEST(testSingleCreation);
+    CPPUNIT_TEST(testIndexSequenceCreation);
+    CPPUNIT_TEST(testMoveOnly);
+    CPPUNIT_TEST(testRvalueRepeatedIndex);
     CPPUNIT_TEST_SUITE_END();
 public:
     void setUp();
@@ -28,6 +33,9 @@ protected:
     void testVariousCreation();
     void testNullCreation();
     void testSingleCreation();
+    void testIndexSequenceCreation();
+    void testMoveOnly();
+    void testRvalueRepeatedIndex();
     std::tuple<int, float, double, char, std::string> base {1, 2.2, 3.3, '4', "test"};
 };
 
@@ -93,6 +101,41 @@ void TestMakeCustomTuple::testSingleCreation()
     CPPUNIT_ASSERT(1 == std::tuple_size<decltype(result)>::value);
 }
 
+void TestMakeCustomTuple::testIndexSequenceCreation()
+{
+    auto result = tuple_utils::make_custom_tuple(base, tuple_utils::index_sequence<4, 0, 0>());
+
+    static_assert(std::is_same<decltype(result), std::tuple<std::string, int, int>>::value, "Type mismatch");
+    CPPUNIT_ASSERT(std::get<0>(result) == std::get<4>(base));
+    CPPUNIT_ASSERT(std::get<1>(result) == std::get<0>(base));
+    CPPUNIT_ASSERT(std::get<2>(result) == std::get<0>(base));
+}
+
+void TestMakeCustomTuple::testMoveOnly()
+{
+    auto arg = std::make_tuple(std::unique_ptr<int>(new int(1)), 2, std::unique_ptr<int>(new int(3)));
+    auto result = tuple_utils::make_custom_tuple<2, 1, 0>(std::move(arg));
+
+    static_assert(
+        std::is_same<std::tuple<std::unique_ptr<int>, int, std::unique_ptr<int>>, decltype(result)>::value,
+        "Type mismatch"
+    );
+    CPPUNIT_ASSERT(3 == *std::get<0>(result));
+    CPPUNIT_ASSERT(2 == std::get<1>(result));
+    CPPUNIT_ASSERT(1 == *std::get<2>(result));
+    CPPUNIT_ASSERT(nullptr == std::get<0>(arg));
+    CPPUNIT_ASSERT(nullptr == std::get<2>(arg));
+}
+
+void TestMakeCustomTuple::testRvalueRepeatedIndex()
+{
+    auto arg = std::make_tuple(std::string("copied"), std::string("moved"));
+    auto result = tuple_utils::make_custom_tuple<0, 1, 0>(std::move(arg));
+
+    CPPUNIT_ASSERT(std::make_tuple(std::string("copied"), std::string("moved"), std::string("copied")) == result);
+    CPPUNIT_ASSERT("copied" == std::get<0>(arg));
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION( TestMakeCustomTuple );
 
 int main()
@@ -1,13 +1,24 @@
 #include "../src/merge_tuples.hpp"
+#include "../src/c_product_view.hpp"
+#include "../src/merged_view.hpp"
+#include "../src/index_view.hpp"
 #include <tuple>
 #include <string>
 #include <type_traits>
+#include <memory>
+#include <vector>
 #include <cppunit/extensions/TestFactoryRegistry.h>
 #include <cppunit/ui/text/TestRunner.h>
 #include <cppunit/extensions/HelperMacros.h>
 #include <cppunit/TestCase.h>
 #include <cppunit/TestFixture.h>
 
+struct NoDefault
+{
+    explicit NoDefault(int v) : value(v) {}
+    int value;
+};
+
 class TestMergeTuple : public CppUnit::TestFixture
 {
     CPPUNIT_TEST_SUITE(TestMergeTuple);
@@ -21,6 +32,10 @@ class TestMergeTuple : public CppUnit::TestFixture
     CPPUNIT_TEST(testOnlyEmpty);
     CPPUNIT_TEST(testTuples1Elem);
     CPPUNIT_TEST(testTuples2Elem);
+    CPPUNIT_TEST(testNoDefaultConstructor);
+    CPPUNIT_TEST(testMoveRvalues);
+    CPPUNIT_TEST(testMixedValueCategories);
+    CPPUNIT_TEST(testViews);
     CPPUNIT_TEST_SUITE_END();
 public:
     void setUp();
@@ -36,6 +51,10 @@ protected:
     void testOnlyEmpty();
     void testTuples1Elem();
     void testTuples2Elem();
+    void testNoDefaultConstructor();
+    void testMoveRvalues();
+    void testMixedValueCategories();
+    void testViews();
 };
 
 void TestMergeTuple::setUp()
@@ -235,6 +254,70 @@ void TestMergeTuple::testTuples2Elem()
     CPPUNIT_ASSERT(3 == std::get<5>(result));
 }
 
+void TestMergeTuple::testNoDefaultConstructor()
+{
+    auto result = tuple_utils::merge(std::make_tuple(NoDefault(1)), std::make_tuple(2, NoDefault(3)));
+
+    static_assert(std::is_same<std::tuple<NoDefault, int, NoDefault>, decltype(result)>::value, "Type mismatch");
+    CPPUNIT_ASSERT(1 == std::get<0>(result).value);
+    CPPUNIT_ASSERT(2 == std::get<1>(result));
+    CPPUNIT_ASSERT(3 == std::get<2>(result).value);
+}
+
+void TestMergeTuple::testMoveRvalues()
+{
+    auto arg1 = std::make_tuple(std::unique_ptr<int>(new int(4)), std::vector<int>{1, 2, 3});
+    auto arg2 = std::make_tuple(std::unique_ptr<int>(new int(5)));
+    const int* data = std::get<1>(arg1).data();
+    auto result = tuple_utils::merge(std::move(arg1), std::move(arg2), std::make_tuple(6));
+
+    static_assert(
+        std::is_same<std::tuple<std::unique_ptr<int>, std::vector<int>, std::unique_ptr<int>, int>, decltype(result)>::value,
+        "Type mismatch"
+    );
+    CPPUNIT_ASSERT(4 == *std::get<0>(result));
+    CPPUNIT_ASSERT(data == std::get<1>(result).data());
+    CPPUNIT_ASSERT(5 == *std::get<2>(result));
+    CPPUNIT_ASSERT(6 == std::get<3>(result));
+    CPPUNIT_ASSERT(nullptr == std::get<0>(arg1));
+    CPPUNIT_ASSERT(nullptr == std::get<0>(arg2));
+}
+
+void TestMergeTuple::testMixedValueCategories()
+{
+    auto arg1 = std::make_tuple(std::string("hello"), 1);
+    const auto arg2 = std::make_tuple(std::string(" "));
+    auto arg3 = std::make_tuple(std::string("world"));
+    auto result = tuple_utils::merge(arg1, arg2, std::move(arg3));
+
+    static_assert(
+        std::is_same<std::tuple<std::string, int, std::string, std::string>, decltype(result)>::value,
+        "Type mismatch"
+    );
+    CPPUNIT_ASSERT(std::make_tuple(std::string("hello"), 1, std::string(" "), std::string("world")) == result);
+    CPPUNIT_ASSERT("hello" == std::get<0>(arg1));
+    CPPUNIT_ASSERT(" " == std::get<0>(arg2));
+}
+
+void TestMergeTuple::testViews()
+{
+    auto x = std::make_tuple(1, 2);
+    auto y = std::make_tuple('a');
+    auto z = std::make_tuple(std::string("z"));
+    auto product = tuple_utils::make_c_product_view(x, y);
+    auto merged = tuple_utils::make_merged_view(x, z);
+    auto result = tuple_utils::merge(product, merged, y);
+
+    static_assert(
+        std::is_same<std::tuple<std::tuple<int, char>, std::tuple<int, char>, int, int, std::string, char>,
+                     decltype(result)>::value,
+        "Type mismatch"
+    );
+    CPPUNIT_ASSERT(std::make_tuple(std::make_tuple(1, 'a'), std::make_tuple(2, 'a'), 1, 2, std::string("z"), 'a')
+                   == result);
+    CPPUNIT_ASSERT(std::make_tuple(2, 1, 'a') == tuple_utils::merge(tuple_utils::view_reverse(x), y));
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION( TestMergeTuple );
 
 int main()
@@ -0,0 +1,265 @@
+#include "../src/merged_view.hpp"
+#include "../src/explode.hpp"
+#include "../src/fold_tuples.hpp"
+#include "../src/zip_tuples.hpp"
+#include "../src/print_tuple.hpp"
+#include <tuple>
+#include <string>
+#include <memory>
+#include <type_traits>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestCase.h>
+#include <cppunit/TestFixture.h>
+
+struct Sum
+{
+    template <typename... T>
+    int operator()(T... values) const
+    {
+        int result = 0;
+        for (int v : {static_cast<int>(values)...})
+        {
+            result += v;
+        }
+        return result;
+    }
+};
+
+struct Concat
+{
+    std::string operator()(const std::string& first, const std::string& second) const
+    {
+        return first + second;
+    }
+};
+
+class TestMergedView : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestMergedView);
+    CPPUNIT_TEST(testGet);
+    CPPUNIT_TEST(testReferences);
+    CPPUNIT_TEST(testConstTuple);
+    CPPUNIT_TEST(testRvalueTuple);
+    CPPUNIT_TEST(testTupleTraits);
+    CPPUNIT_TEST(testEmptyTuples);
+    CPPUNIT_TEST(testExplode);
+    CPPUNIT_TEST(testFold);
+    CPPUNIT_TEST(testZip);
+    CPPUNIT_TEST(testPrint);
+    CPPUNIT_TEST(testPrintEmpty);
+    CPPUNIT_TEST(testMaterialize);
+    CPPUNIT_TEST(testMaterializeMove);
+    CPPUNIT_TEST_SUITE_END();
+public:
+    void setUp();
+    void tearDown();
+protected:
+    void testGet();
+    void testReferences();
+    void testConstTuple();
+    void testRvalueTuple();
+    void testTupleTraits();
+    void testEmptyTuples();
+    void testExplode();
+    void testFold();
+    void testZip();
+    void testPrint();
+    void testPrintEmpty();
+    void testMaterialize();
+    void testMaterializeMove();
+};
+
+void TestMergedView::setUp()
+{}
+
+void TestMergedView::tearDown()
+{
+    tuple_utils::change_delim(", ");
+    tuple_utils::change_braces("(", ")");
+}
+
+void TestMergedView::testGet()
+{
+    std::tuple<int, long, std::string> arg1 {1, 22, "hello"};
+    std::tuple<char> arg2 {'a'};
+    std::tuple<std::string, short> arg3 {"world", 4};
+    auto view = tuple_utils::make_merged_view(arg1, arg2, arg3);
+
+    CPPUNIT_ASSERT(1 == tuple_utils::get<0>(view));
+    CPPUNIT_ASSERT(22 == tuple_utils::get<1>(view));
+    CPPUNIT_ASSERT("hello" == tuple_utils::get<2>(view));
+    CPPUNIT_ASSERT('a' == tuple_utils::get<3>(view));
+    CPPUNIT_ASSERT("world" == tuple_utils::get<4>(view));
+    CPPUNIT_ASSERT(4 == tuple_utils::get<5>(view));
+}
+
+void TestMergedView::testReferences()
+{
+    std::tuple<int, std::string> arg1 {1, "hello"};
+    std::tuple<int> arg2 {2};
+    auto view = tuple_utils::make_merged_view(arg1, arg2);
+
+    static_assert(std::is_same<int&, decltype(tuple_utils::get<2>(view))>::value, "Type mismatch");
+    CPPUNIT_ASSERT(&std::get<1>(arg1) == &tuple_utils::get<1>(view));
+    CPPUNIT_ASSERT(&std::get<0>(arg2) == &tuple_utils::get<2>(view));
+
+    tuple_utils::get<2>(view) = 5;
+    std::get<0>(arg1) = 7;
+    CPPUNIT_ASSERT(5 == std::get<0>(arg2));
+    CPPUNIT_ASSERT(7 == tuple_utils::get<0>(view));
+}
+
+void TestMergedView::testConstTuple()
+{
+    const std::tuple<int, std::string> arg1 {1, "hello"};
+    std::tuple<int> arg2 {2};
+    auto view = tuple_utils::make_merged_view(arg1, arg2);
+
+    static_assert(std::is_same<const int&, decltype(tuple_utils::get<0>(view))>::value, "Type mismatch");
+    static_assert(std::is_same<int&, decltype(tuple_utils::get<2>(view))>::value, "Type mismatch");
+    static_assert(
+        std::is_same<const std::string, std::tuple_element<1, decltype(view)>::type>::value,
+        "Type mismatch"
+    );
+    CPPUNIT_ASSERT("hello" == tuple_utils::get<1>(view));
+}
+
+void TestMergedView::testRvalueTuple()
+{
+    std::tuple<int> arg1 {1};
+    auto view = tuple_utils::make_merged_view(arg1, std::make_tuple(std::string("kept"), 2));
+
+    //rvalue tuple is moved into the view, lvalue tuple is only referenced
+    static_assert(std::is_same<decltype(view.tuples), std::tuple<std::tuple<int>&, std::tuple<std::string, int>>>::value,
+                  "Type mismatch");
+    static_assert(std::is_same<const std::string&, decltype(tuple_utils::get<1>(view))>::value, "Type mismatch");
+    CPPUNIT_ASSERT(&arg1 == &std::get<0>(view.tuples));
+    CPPUNIT_ASSERT(&std::get<0>(std::get<1>(view.tuples)) == &tuple_utils::get<1>(view));
+    CPPUNIT_ASSERT(std::make_tuple(1, std::string("kept"), 2) == tuple_utils::materialize(view));
+}
+
+void TestMergedView::testTupleTraits()
+{
+    std::tuple<int, long> arg1 {1, 2};
+    std::tuple<> arg2;
+    std::tuple<std::string, char, double> arg3 {"a", 'b', 1.0};
+    auto view = tuple_utils::make_merged_view(arg1, arg2, arg3);
+    using View = decltype(view);
+
+    static_assert(5 == std::tuple_size<View>::value, "Size mismatch");
+    static_assert(std::is_same<int, std::tuple_element<0, View>::type>::value, "Type mismatch");
+    static_assert(std::is_same<long, std::tuple_element<1, View>::type>::value, "Type mismatch");
+    static_assert(std::is_same<std::string, std::tuple_element<2, View>::type>::value, "Type mismatch");
+    static_assert(std::is_same<char, std::tuple_element<3, View>::type>::value, "Type mismatch");
+    static_assert(std::is_same<double, std::tuple_element<4, View>::type>::value, "Type mismatch");
+    static_assert(5 == tuple_utils::size_bare<const View&>::value, "Size mismatch");
+    CPPUNIT_ASSERT('b' == tuple_utils::get<3>(view));
+}
+
+void TestMergedView::testEmptyTuples()
+{
+    std::tuple<> arg1;
+    std::tuple<> arg2;
+    auto view = tuple_utils::make_merged_view(arg1, arg2);
+
+    static_assert(0 == std::tuple_size<decltype(view)>::value, "Size mismatch");
+    CPPUNIT_ASSERT(std::tuple<>() == tuple_utils::materialize(view));
+}
+
+void TestMergedView::testExplode()
+{
+    auto arg1 = std::make_tuple(1, 2);
+    auto arg2 = std::make_tuple(3, 4, 5);
+    auto view = tuple_utils::make_merged_view(arg1, arg2);
+
+    CPPUNIT_ASSERT(15 == tuple_utils::explode(Sum(), view));
+    CPPUNIT_ASSERT(15 == tuple_utils::explode(Sum(), tuple_utils::make_merged_view(arg1, arg2)));
+}
+
+void TestMergedView::testFold()
+{
+    auto arg1 = std::make_tuple(std::string("a"), std::string("b"));
+    auto arg2 = std::make_tuple(std::string("c"));
+    auto arg3 = std::make_tuple(std::string("x"), std::string("y"));
+    auto arg4 = std::make_tuple(std::string("z"));
+    auto view1 = tuple_utils::make_merged_view(arg1, arg2);
+    auto view2 = tuple_utils::make_merged_view(arg3, arg4);
+
+    auto result = tuple_utils::fold(Concat(), view1, view2);
+    CPPUNIT_ASSERT(std::make_tuple(std::string("ax"), std::string("by"), std::string("cz")) == result);
+}
+
+void TestMergedView::testZip()
+{
+    auto arg1 = std::make_tuple(1, 2);
+    auto arg2 = std::make_tuple(3);
+    auto arg3 = std::make_tuple('a', 'b', 'c', 'd');
+    auto view = tuple_utils::make_merged_view(arg1, arg2);
+
+    auto result = tuple_utils::zip(view, arg3);
+    CPPUNIT_ASSERT(std::make_tuple(std::make_tuple(1, 'a'), std::make_tuple(2, 'b'), std::make_tuple(3, 'c')) == result);
+}
+
+void TestMergedView::testPrint()
+{
+    auto arg1 = std::make_tuple(1, std::string("hello"));
+    auto arg2 = std::make_tuple(std::make_tuple(2, 3), 'c');
+    auto view = tuple_utils::make_merged_view(arg1, arg2);
+
+    CPPUNIT_ASSERT("(1, hello, (2, 3), c)" == tuple_utils::to_string(view));
+    CPPUNIT_ASSERT(tuple_utils::to_string(tuple_utils::merge(arg1, arg2)) == tuple_utils::to_string(view));
+
+    tuple_utils::change_delim(" ");
+    tuple_utils::change_braces("[", "]");
+    std::ostringstream stream;
+    stream << view;
+    CPPUNIT_ASSERT("[1 hello [2 3] c]" == stream.str());
+}
+
+void TestMergedView::testPrintEmpty()
+{
+    std::tuple<> arg1;
+    auto view = tuple_utils::make_merged_view(arg1);
+
+    CPPUNIT_ASSERT("" == tuple_utils::to_string(view));
+}
+
+void TestMergedView::testMaterialize()
+{
+    auto arg1 = std::make_tuple(1, std::string("hello"));
+    const auto arg2 = std::make_tuple(2.5);
+    auto view = tuple_utils::make_merged_view(arg1, arg2);
+    auto result = tuple_utils::materialize(view);
+
+    static_assert(std::is_same<std::tuple<int, std::string, double>, decltype(result)>::value, "Type mismatch");
+    CPPUNIT_ASSERT(tuple_utils::merge(arg1, arg2) == result);
+    CPPUNIT_ASSERT("hello" == std::get<1>(arg1));
+}
+
+void TestMergedView::testMaterializeMove()
+{
+    auto arg1 = std::make_tuple(std::unique_ptr<int>(new int(1)));
+    auto arg2 = std::make_tuple(std::string("copied"));
+    auto result = tuple_utils::materialize(tuple_utils::make_merged_view(std::move(arg1), arg2));
+
+    static_assert(
+        std::is_same<std::tuple<std::unique_ptr<int>, std::string>, decltype(result)>::value,
+        "Type mismatch"
+    );
+    CPPUNIT_ASSERT(1 == *std::get<0>(result));
+    CPPUNIT_ASSERT(nullptr == std::get<0>(arg1));
+    CPPUNIT_ASSERT("copied" == std::get<0>(arg2));
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestMergedView );
+
+int main()
+{
+    CppUnit::TextUi::TestRunner runner;
+    CppUnit::TestFactoryRegistry &registry = CppUnit::TestFactoryRegistry::getRegistry();
+    runner.addTest(registry.makeTest());
+    bool wasSuccessful = runner.run("", false);
+    return wasSuccessful;
+}
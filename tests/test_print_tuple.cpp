@@ -1,4 +1,9 @@
 #include "../src/print_tuple.hpp"
+#include "../src/merged_view.hpp"
+#include "../src/index_view.hpp"
+#include "../src/c_product_view.hpp"
+#include <array>
+#include <utility>
 #include <tuple>
 #include <string>
 #include <sstream>
@@ -31,6 +36,11 @@ class TestPrintTuple : public CppUnit::TestFixture
     CPPUNIT_TEST(testToString3arg);
     CPPUNIT_TEST(testToStringDelim);
     CPPUNIT_TEST(testToStringBraces);
+    CPPUNIT_TEST(testPairAndArray);
+    CPPUNIT_TEST(testMergedView);
+    CPPUNIT_TEST(testIndexView);
+    CPPUNIT_TEST(testCProductView);
+    CPPUNIT_TEST(testNestedView);
     CPPUNIT_TEST_SUITE_END();
 public:
     void setUp();
@@ -55,6 +65,11 @@ protected:
     void testToString3arg();
     void testToStringDelim();
     void testToStringBraces();
+    void testPairAndArray();
+    void testMergedView();
+    void testIndexView();
+    void testCProductView();
+    void testNestedView();
 };
 
 void TestPrintTuple::setUp()
@@ -255,6 +270,65 @@ void TestPrintTuple::testToStringBraces()
     CPPUNIT_ASSERT("[3, test, 5]" == result);
 }
 
+void TestPrintTuple::testPairAndArray()
+{
+    std::ostringstream outstream;
+    std::pair<int, const char*> arg1{3, "test"};
+    std::array<int, 3> arg2{{1, 2, 3}};
+    std::array<int, 0> arg3{};
+    tuple_utils::change_braces("[", "]");
+    outstream << arg1 << arg2 << arg3;
+
+    CPPUNIT_ASSERT(outstream.str() == "[3, test][1, 2, 3]");
+    CPPUNIT_ASSERT("[3, test]" == tuple_utils::to_string(arg1));
+    CPPUNIT_ASSERT(tuple_utils::to_string(arg3).empty());
+}
+
+void TestPrintTuple::testMergedView()
+{
+    std::ostringstream outstream;
+    auto arg1 = std::make_tuple(1, std::string("hello"));
+    auto arg2 = std::make_tuple('c');
+    auto view = tuple_utils::make_merged_view(arg1, arg2);
+    outstream << view;
+
+    CPPUNIT_ASSERT(outstream.str() == "1, hello, c");
+    CPPUNIT_ASSERT("1, hello, c" == tuple_utils::to_string(view));
+}
+
+void TestPrintTuple::testIndexView()
+{
+    auto arg1 = std::make_tuple(1, 2.5);
+    auto arg2 = std::make_tuple(std::string("x"));
+    auto view = tuple_utils::make_index_view(arg1, arg2);
+    tuple_utils::change_delim(" ");
+
+    CPPUNIT_ASSERT("1 2.5 x" == tuple_utils::to_string(view));
+    CPPUNIT_ASSERT(tuple_utils::to_string(std::tuple<>()) == tuple_utils::to_string(tuple_utils::make_index_view()));
+}
+
+void TestPrintTuple::testCProductView()
+{
+    auto arg1 = std::make_tuple(1, 2);
+    auto arg2 = std::make_tuple('a', 'b');
+    auto view = tuple_utils::make_c_product_view(arg1, arg2);
+    tuple_utils::change_braces("(", ")");
+
+    CPPUNIT_ASSERT("((1, a), (1, b), (2, a), (2, b))" == tuple_utils::to_string(view));
+}
+
+void TestPrintTuple::testNestedView()
+{
+    std::ostringstream outstream;
+    auto arg1 = std::make_tuple(1, 2);
+    auto arg2 = std::make_tuple(3);
+    auto view = tuple_utils::make_merged_view(arg1, arg2);
+    tuple_utils::change_braces("{", "}");
+    outstream << std::make_tuple(0, view);
+
+    CPPUNIT_ASSERT(outstream.str() == "{0, {1, 2, 3}}");
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION( TestPrintTuple );
 
 int main()
@@ -0,0 +1,296 @@
+#include <tuple>
+#include <string>
+#include <vector>
+#include <array>
+#include <deque>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestCase.h>
+#include <cppunit/TestFixture.h>
+#include "../src/product_range.hpp"
+#include "../src/cartesian_product.hpp"
+
+class TestProductRange : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestProductRange);
+    CPPUNIT_TEST(testIterate);
+    CPPUNIT_TEST(testOrder);
+    CPPUNIT_TEST(testModify);
+    CPPUNIT_TEST(testEmpty);
+    CPPUNIT_TEST(testEmptyFirst);
+    CPPUNIT_TEST(testConst);
+    CPPUNIT_TEST(testRvalueContainer);
+    CPPUNIT_TEST(testCoordinates);
+    CPPUNIT_TEST(testRandomAccess);
+    CPPUNIT_TEST(testChunks);
+    CPPUNIT_TEST(testChunkArguments);
+    CPPUNIT_TEST(testAlgorithms);
+    CPPUNIT_TEST_SUITE_END();
+public:
+    void setUp();
+    void tearDown();
+protected:
+    void testIterate();
+    void testOrder();
+    void testModify();
+    void testEmpty();
+    void testEmptyFirst();
+    void testConst();
+    void testRvalueContainer();
+    void testCoordinates();
+    void testRandomAccess();
+    void testChunks();
+    void testChunkArguments();
+    void testAlgorithms();
+};
+
+void TestProductRange::setUp()
+{}
+
+void TestProductRange::tearDown()
+{}
+
+void TestProductRange::testIterate()
+{
+    std::vector<int> x = {1, 2};
+    std::vector<std::string> y = {"a", "b", "c"};
+    auto range = tuple_utils::product_range(x, y);
+
+    static_assert(std::is_same<decltype(*range.begin()), std::tuple<int&, std::string&>>::value, "Type mismatch");
+
+    CPPUNIT_ASSERT(6 == range.size());
+    std::string result;
+    for (auto element : range)
+    {
+        result += std::to_string(std::get<0>(element)) + std::get<1>(element);
+    }
+    CPPUNIT_ASSERT("1a1b1c2a2b2c" == result);
+    CPPUNIT_ASSERT(&x[1] == &std::get<0>(range[4]));
+    CPPUNIT_ASSERT(&y[1] == &std::get<1>(range[4]));
+}
+
+void TestProductRange::testOrder()
+{
+    std::vector<int> x = {1, 2};
+    std::deque<char> y = {'a', 'b', 'c'};
+    std::array<double, 2> z = {{0.5, 1.5}};
+    auto expected = tuple_utils::c_product(std::make_tuple(1, 2),
+                                           std::make_tuple('a', 'b', 'c'),
+                                           std::make_tuple(0.5, 1.5));
+    auto range = tuple_utils::product_range(x, y, z);
+
+    CPPUNIT_ASSERT(std::tuple_size<decltype(expected)>::value == range.size());
+    CPPUNIT_ASSERT(std::get<0>(expected) == range[0]);
+    CPPUNIT_ASSERT(std::get<3>(expected) == range[3]);
+    CPPUNIT_ASSERT(std::get<6>(expected) == range[6]);
+    CPPUNIT_ASSERT(std::get<9>(expected) == range[9]);
+    CPPUNIT_ASSERT(std::get<11>(expected) == range[11]);
+}
+
+void TestProductRange::testModify()
+{
+    std::vector<int> x = {1, 2, 3};
+    std::vector<int> y = {10, 20};
+    std::vector<int> counts(3);
+
+    for (auto element : tuple_utils::product_range(x, y, counts))
+    {
+        ++std::get<2>(element);
+    }
+
+    CPPUNIT_ASSERT(std::vector<int>({6, 6, 6}) == counts);
+}
+
+void TestProductRange::testEmpty()
+{
+    std::vector<int> x = {1, 2};
+    std::vector<int> y;
+    auto range = tuple_utils::product_range(x, y);
+
+    CPPUNIT_ASSERT(range.empty());
+    CPPUNIT_ASSERT(0 == range.size());
+    CPPUNIT_ASSERT(range.begin() == range.end());
+    CPPUNIT_ASSERT(range.chunk(1, 4).empty());
+    CPPUNIT_ASSERT((std::array<std::size_t, 2>{{0, 0}}) == range.coordinates(0));
+}
+
+void TestProductRange::testEmptyFirst()
+{
+    std::vector<int> x;
+    std::vector<int> y = {1, 2};
+    std::deque<char> z = {'a', 'b', 'c'};
+    const auto range = tuple_utils::product_range(x, y, z);
+
+    CPPUNIT_ASSERT(0 == range.size());
+    CPPUNIT_ASSERT(range.begin() == range.end());
+    CPPUNIT_ASSERT((std::array<std::size_t, 3>{{0, 0, 0}}) == range.coordinates(0));
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        CPPUNIT_ASSERT(range.chunk(i, 3).empty());
+        CPPUNIT_ASSERT(0 == range.chunk(i, 3).size());
+    }
+}
+
+void TestProductRange::testConst()
+{
+    std::vector<int> x = {1, 2};
+    std::vector<int> y = {3, 4};
+    const auto range = tuple_utils::product_range(x, y);
+
+    static_assert(std::is_same<decltype(*range.begin()), std::tuple<const int&, const int&>>::value,
+                  "Type mismatch");
+    static_assert(std::is_same<decltype(range[0]), std::tuple<const int&, const int&>>::value, "Type mismatch");
+
+    int sum = 0;
+    for (auto element : range)
+    {
+        sum += std::get<0>(element) * std::get<1>(element);
+    }
+    CPPUNIT_ASSERT(21 == sum);
+}
+
+void TestProductRange::testRvalueContainer()
+{
+    std::vector<int> x = {1, 2};
+    auto range = tuple_utils::product_range(x, std::vector<std::string>{"a", "b"});
+
+    static_assert(std::is_same<decltype(range),
+                               tuple_utils::cartesian_range<std::vector<int>&, std::vector<std::string>>>::value,
+                  "Type mismatch");
+    CPPUNIT_ASSERT(std::make_tuple(2, std::string("a")) == range[2]);
+}
+
+void TestProductRange::testCoordinates()
+{
+    std::vector<int> x = {1, 2};
+    std::vector<int> y = {1, 2, 3};
+    std::vector<int> z = {1, 2, 3, 4};
+    auto range = tuple_utils::product_range(x, y, z);
+
+    CPPUNIT_ASSERT(24 == range.size());
+    for (std::size_t k = 0; k < range.size(); ++k)
+    {
+        const std::array<std::size_t, 3> coordinates = range.coordinates(k);
+        CPPUNIT_ASSERT(k == (coordinates[0] * 3 + coordinates[1]) * 4 + coordinates[2]);
+        CPPUNIT_ASSERT(&std::get<1>(range[k]) == &y[coordinates[1]]);
+    }
+    const std::array<std::size_t, 3> expected = {{1, 2, 1}};
+    CPPUNIT_ASSERT(expected == range.coordinates(21));
+}
+
+void TestProductRange::testRandomAccess()
+{
+    std::vector<int> x = {1, 2, 3};
+    std::vector<int> y = {4, 5};
+    auto range = tuple_utils::product_range(x, y);
+
+    auto it = range.begin();
+
+    static_assert(std::is_same<std::iterator_traits<decltype(it)>::iterator_category,
+                               std::input_iterator_tag>::value, "Category mismatch");
+    static_assert(std::is_same<decltype(it)::iterator_concept,
+                               std::random_access_iterator_tag>::value, "Concept mismatch");
+
+    it += 3;
+    CPPUNIT_ASSERT(std::make_tuple(2, 5) == *it);
+    CPPUNIT_ASSERT(3 == it.position());
+    CPPUNIT_ASSERT(std::make_tuple(1, 5) == it[-2]);
+    CPPUNIT_ASSERT(std::make_tuple(2, 4) == *(it - 1));
+    CPPUNIT_ASSERT(std::make_tuple(3, 4) == *(1 + it));
+    CPPUNIT_ASSERT(range.end() - it == 3);
+    CPPUNIT_ASSERT(range.begin() < it && it <= range.end() && range.end() > it);
+
+    auto reversed = std::reverse_iterator<decltype(it)>(range.end());
+    CPPUNIT_ASSERT(std::make_tuple(3, 5) == *reversed);
+
+    auto found = std::find_if(range.begin(), range.end(),
+                              [](std::tuple<int&, int&> element) { return std::get<0>(element) == 3; });
+    CPPUNIT_ASSERT(4 == found - range.begin());
+}
+
+void TestProductRange::testChunks()
+{
+    std::vector<int> x = {1, 2, 3};
+    std::vector<int> y = {1, 2, 3, 4, 5, 6, 7};
+    auto range = tuple_utils::product_range(x, y);
+
+    std::vector<int> visits(range.size());
+    std::size_t covered = 0;
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        auto chunk = range.chunk(i, 4);
+        CPPUNIT_ASSERT(chunk.size() == 5 || chunk.size() == 6);
+        CPPUNIT_ASSERT(static_cast<std::ptrdiff_t>(covered) == chunk.begin().position());
+        for (auto it = chunk.begin(); it != chunk.end(); ++it)
+        {
+            ++visits[static_cast<std::size_t>(it.position())];
+            CPPUNIT_ASSERT(range[static_cast<std::size_t>(it.position())] == *it);
+        }
+        covered += chunk.size();
+    }
+    CPPUNIT_ASSERT(range.size() == covered);
+    CPPUNIT_ASSERT(std::count(visits.begin(), visits.end(), 1) == 21);
+
+    auto slice = range.slice(7, 9);
+    CPPUNIT_ASSERT(2 == slice.size());
+    CPPUNIT_ASSERT(std::make_tuple(2, 1) == *slice.begin());
+}
+
+void TestProductRange::testChunkArguments()
+{
+    std::vector<int> x = {1, 2, 3};
+    std::vector<int> y = {1, 2, 3, 4, 5, 6, 7};
+    const auto range = tuple_utils::product_range(x, y);
+
+    //21 = 4 * 5 + 1, the first chunk takes the remainder
+    CPPUNIT_ASSERT(6 == range.chunk(0, 4).size());
+    CPPUNIT_ASSERT(5 == range.chunk(3, 4).size());
+    CPPUNIT_ASSERT(21 == range.chunk(0, 1).size());
+    CPPUNIT_ASSERT(1 == range.chunk(20, 30).size());
+    CPPUNIT_ASSERT(range.chunk(29, 30).empty());
+    CPPUNIT_ASSERT_THROW(range.chunk(0, 0), std::invalid_argument);
+    CPPUNIT_ASSERT_THROW(range.chunk(4, 4), std::out_of_range);
+    CPPUNIT_ASSERT_THROW(range.chunk(5, 4), std::out_of_range);
+}
+
+void TestProductRange::testAlgorithms()
+{
+    std::vector<int> x = {1, 2};
+    std::vector<int> y = {10, 20, 30};
+    auto range = tuple_utils::product_range(x, y);
+
+    auto large = std::count_if(range.begin(), range.end(),
+                               [](std::tuple<int&, int&> element) { return std::get<0>(element) * std::get<1>(element) > 20; });
+    CPPUNIT_ASSERT(3 == large);
+
+    std::vector<std::tuple<int, int>> elements(range.begin(), range.end());
+    CPPUNIT_ASSERT(6 == elements.size());
+    CPPUNIT_ASSERT(std::make_tuple(1, 20) == elements[1]);
+    CPPUNIT_ASSERT(std::make_tuple(2, 30) == elements[5]);
+
+    std::vector<std::tuple<int, int>> copied;
+    std::copy(range.begin() + 2, range.end(), std::back_inserter(copied));
+    CPPUNIT_ASSERT(std::equal(copied.begin(), copied.end(), elements.begin() + 2));
+    CPPUNIT_ASSERT(4 == copied.size());
+
+    std::for_each(range.begin(), range.begin() + 3, [](std::tuple<int&, int&> element) { ++std::get<1>(element); });
+    CPPUNIT_ASSERT(std::vector<int>({11, 21, 31}) == y);
+
+    CPPUNIT_ASSERT(6 == std::distance(range.begin(), range.end()));
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestProductRange );
+
+int main()
+{
+    CppUnit::TextUi::TestRunner runner;
+    CppUnit::TestFactoryRegistry &registry = CppUnit::TestFactoryRegistry::getRegistry();
+    runner.addTest(registry.makeTest());
+    bool wasSuccessful = runner.run("", false);
+    return wasSuccessful;
+}
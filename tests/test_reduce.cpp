@@ -0,0 +1,216 @@
+#include "../src/reduce.hpp"
+#include <array>
+#include <tuple>
+#include <string>
+#include <memory>
+#include <type_traits>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestCase.h>
+#include <cppunit/TestFixture.h>
+
+struct Plus
+{
+    template <class T, class U>
+    constexpr auto operator()(T&& t, U&& u) const
+    -> decltype(std::forward<T>(t) + std::forward<U>(u))
+    {
+        return std::forward<T>(t) + std::forward<U>(u);
+    }
+};
+
+struct Parenthesize
+{
+    std::string operator()(const std::string& x, const std::string& y) const
+    {
+        return "(" + x + y + ")";
+    }
+};
+
+struct Size
+{
+    template <class T>
+    std::size_t operator()(const T& x) const
+    {
+        return x.size();
+    }
+};
+
+struct Square
+{
+    template <class T>
+    constexpr T operator()(T x) const
+    {
+        return x * x;
+    }
+};
+
+class TestReduce : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestReduce);
+    CPPUNIT_TEST(testReduce);
+    CPPUNIT_TEST(testReduceInit);
+    CPPUNIT_TEST(testReduceEmpty);
+    CPPUNIT_TEST(testReduceOneElement);
+    CPPUNIT_TEST(testOrderShapes);
+    CPPUNIT_TEST(testResultTypes);
+    CPPUNIT_TEST(testMoveOnly);
+    CPPUNIT_TEST(testTransformReduce);
+    CPPUNIT_TEST(testTupleLike);
+    CPPUNIT_TEST(testConstexpr);
+    CPPUNIT_TEST_SUITE_END();
+public:
+    void setUp();
+    void tearDown();
+protected:
+    void testReduce();
+    void testReduceInit();
+    void testReduceEmpty();
+    void testReduceOneElement();
+    void testOrderShapes();
+    void testResultTypes();
+    void testMoveOnly();
+    void testTransformReduce();
+    void testTupleLike();
+    void testConstexpr();
+};
+
+void TestReduce::setUp()
+{}
+
+void TestReduce::tearDown()
+{}
+
+void TestReduce::testReduce()
+{
+    auto t = std::make_tuple(1, 2L, 3.5);
+    auto result = tuple_utils::reduce(Plus(), t);
+
+    static_assert(std::is_same<double, decltype(result)>::value, "Type mismatch");
+    CPPUNIT_ASSERT(6.5 == result);
+    CPPUNIT_ASSERT(6.5 == tuple_utils::reduce_left(Plus(), t));
+    CPPUNIT_ASSERT(6.5 == tuple_utils::reduce_tree(Plus(), t));
+}
+
+void TestReduce::testReduceInit()
+{
+    auto t = std::make_tuple("a", "b", "c");
+
+    //only the left order adds the initial string first, other orders would add two pointers
+    CPPUNIT_ASSERT(">abc" == tuple_utils::reduce_left(Plus(), t, std::string(">")));
+    CPPUNIT_ASSERT(10 == tuple_utils::reduce(Plus(), std::make_tuple(1, 2, 3), 4));
+}
+
+void TestReduce::testReduceEmpty()
+{
+    std::string init("x");
+    auto result = tuple_utils::reduce(Plus(), std::tuple<>(), init);
+
+    static_assert(std::is_same<std::string, decltype(result)>::value, "Type mismatch");
+    CPPUNIT_ASSERT("x" == result);
+    CPPUNIT_ASSERT(0 == tuple_utils::reduce_tree(Plus(), std::tuple<>(), 0));
+}
+
+void TestReduce::testReduceOneElement()
+{
+    auto t = std::make_tuple(std::string("a"));
+
+    CPPUNIT_ASSERT("a" == tuple_utils::reduce(Parenthesize(), t));
+    CPPUNIT_ASSERT("a" == tuple_utils::reduce_left(Parenthesize(), t));
+    CPPUNIT_ASSERT("(xa)" == tuple_utils::reduce_tree(Parenthesize(), t, std::string("x")));
+}
+
+void TestReduce::testOrderShapes()
+{
+    auto t = std::make_tuple(std::string("a"), std::string("b"), std::string("c"), std::string("d"));
+
+    CPPUNIT_ASSERT("(a(b(cd)))" == tuple_utils::reduce(Parenthesize(), t));
+    CPPUNIT_ASSERT("(((ab)c)d)" == tuple_utils::reduce_left(Parenthesize(), t));
+    CPPUNIT_ASSERT("((ab)(cd))" == tuple_utils::reduce_tree(Parenthesize(), t));
+    CPPUNIT_ASSERT("((xa)(b(cd)))" == tuple_utils::reduce_tree(Parenthesize(), t, std::string("x")));
+}
+
+void TestReduce::testResultTypes()
+{
+    auto t = std::make_tuple(1, 2, 3L);
+
+    static_assert(std::is_same<decltype(tuple_utils::reduce(Plus(), t)),
+                               tuple_utils::result_of_rec<Plus, int&, int&, long&>::type>::value, "Type mismatch");
+    static_assert(std::is_same<decltype(tuple_utils::reduce_left(Plus(), t, 'c')),
+                               tuple_utils::result_of_left<Plus, char, int&, int&, long&>::type>::value,
+                  "Type mismatch");
+    static_assert(std::is_same<decltype(tuple_utils::reduce_tree(Plus(), std::move(t))),
+                               tuple_utils::result_of_tree<Plus, int&&, int&&, long&&>::type>::value,
+                  "Type mismatch");
+    CPPUNIT_ASSERT(6L == tuple_utils::reduce_tree(Plus(), t));
+}
+
+struct PtrPlus
+{
+    std::unique_ptr<int> operator()(std::unique_ptr<int> x, std::unique_ptr<int> y) const
+    {
+        return std::unique_ptr<int>(new int(*x + *y));
+    }
+};
+
+void TestReduce::testMoveOnly()
+{
+    auto make = [](int x, int y, int z) {
+        return std::make_tuple(std::unique_ptr<int>(new int(x)), std::unique_ptr<int>(new int(y)),
+                               std::unique_ptr<int>(new int(z)));
+    };
+
+    CPPUNIT_ASSERT(6 == *tuple_utils::reduce(PtrPlus(), make(1, 2, 3)));
+    CPPUNIT_ASSERT(6 == *tuple_utils::reduce_left(PtrPlus(), make(1, 2, 3)));
+    CPPUNIT_ASSERT(16 == *tuple_utils::reduce_tree(PtrPlus(), make(1, 2, 3), std::unique_ptr<int>(new int(10))));
+
+    auto single = std::make_tuple(std::unique_ptr<int>(new int(7)));
+    auto result = tuple_utils::reduce(PtrPlus(), std::move(single));
+    CPPUNIT_ASSERT(7 == *result);
+    CPPUNIT_ASSERT(!std::get<0>(single));
+}
+
+void TestReduce::testTransformReduce()
+{
+    auto t = std::make_tuple(std::string("ab"), std::array<int, 3>(), std::string("c"));
+
+    CPPUNIT_ASSERT(6 == tuple_utils::transform_reduce(Plus(), Size(), t));
+    CPPUNIT_ASSERT(6 == tuple_utils::transform_reduce_left(Plus(), Size(), t));
+    CPPUNIT_ASSERT(16 == tuple_utils::transform_reduce_tree(Plus(), Size(), t, 10));
+    CPPUNIT_ASSERT(16.25 == tuple_utils::transform_reduce(Plus(), Square(), std::make_tuple(1, 2.5, 3L)));
+}
+
+void TestReduce::testTupleLike()
+{
+    std::array<int, 5> a {{1, 2, 3, 4, 5}};
+
+    CPPUNIT_ASSERT(15 == tuple_utils::reduce_tree(Plus(), a));
+    CPPUNIT_ASSERT(3 == tuple_utils::reduce(Plus(), std::make_pair(1, 2)));
+}
+
+void TestReduce::testConstexpr()
+{
+#if __cplusplus >= 201402L
+    static_assert(tuple_utils::reduce(Plus(), std::make_tuple(1, 2L, 3)) == 6L, "Not reduced at compile time");
+    static_assert(tuple_utils::reduce_left(Plus(), std::make_tuple(1, 2, 3), 4) == 10, "Not reduced at compile time");
+    static_assert(tuple_utils::reduce_tree(Plus(), std::make_tuple(1, 2, 3, 4, 5)) == 15, "Not reduced at compile time");
+    static_assert(tuple_utils::transform_reduce_tree(Plus(), Square(), std::make_tuple(1, 2, 3)) == 14,
+                  "Not reduced at compile time");
+    constexpr auto sum = tuple_utils::reduce_tree(Plus(), std::make_tuple(1, 2.5));
+    CPPUNIT_ASSERT(3.5 == sum);
+#else
+    CPPUNIT_ASSERT(14 == tuple_utils::transform_reduce_tree(Plus(), Square(), std::make_tuple(1, 2, 3)));
+#endif
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestReduce );
+
+int main()
+{
+    CppUnit::TextUi::TestRunner runner;
+    CppUnit::TestFactoryRegistry &registry = CppUnit::TestFactoryRegistry::getRegistry();
+    runner.addTest(registry.makeTest());
+    bool wasSuccessful = runner.run("", false);
+    return wasSuccessful;
+}
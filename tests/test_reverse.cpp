@@ -1,6 +1,7 @@
 #include "../src/reverse.hpp"
 #include <tuple>
 #include <string>
+#include <memory>
 #include <cppunit/extensions/TestFactoryRegistry.h>
 #include <cppunit/ui/text/TestRunner.h>
 #include <cppunit/extensions/HelperMacros.h>
@@ -20,6 +21,7 @@ class TestReverseTuple : public CppUnit::TestFixture
     CPPUNIT_TEST(testRvalue);
     CPPUNIT_TEST(testLvalue);
     CPPUNIT_TEST(testConst);
+    CPPUNIT_TEST(testMoveOnly);
     CPPUNIT_TEST_SUITE_END();
 public:
     void setUp();
@@ -34,6 +36,7 @@ protected:
     void testRvalue();
     void testLvalue();
     void testConst();
+    void testMoveOnly();
 };
 
 void TestReverseTuple::setUp()
@@ -125,6 +128,16 @@ void TestReverseTuple::testConst()
     CPPUNIT_ASSERT(std::make_tuple(45.5f, "test", 12L) == result);
 }
 
+void TestReverseTuple::testMoveOnly()
+{
+    auto arg = std::make_tuple(std::unique_ptr<int>(new int(1)), std::string("moved"));
+    auto result = tuple_utils::reverse(std::move(arg));
+
+    CPPUNIT_ASSERT("moved" == std::get<0>(result));
+    CPPUNIT_ASSERT(1 == *std::get<1>(result));
+    CPPUNIT_ASSERT(nullptr == std::get<0>(arg));
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION( TestReverseTuple );
 
 int main()
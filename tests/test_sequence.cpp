@@ -1,4 +1,5 @@
 #include "../src/aux/sequence.hpp"
+#include "../src/aux/sequence_algebra.hpp"
 #include <cppunit/extensions/TestFactoryRegistry.h>
 #include <cppunit/ui/text/TestRunner.h>
 #include <cppunit/extensions/HelperMacros.h>
@@ -7,6 +8,34 @@
 
 #include <sstream>
 #include <type_traits>
+#include <vector>
+
+#if defined(TUPLE_UTILS_NO_SEQUENCE_INTRINSICS) && \
+    (defined(TUPLE_UTILS_HAS_MAKE_INTEGER_SEQ) || defined(TUPLE_UTILS_HAS_INTEGER_PACK))
+#error "TUPLE_UTILS_NO_SEQUENCE_INTRINSICS should disable compiler built-ins"
+#endif
+
+template <int... I>
+std::vector<int> toVector(tuple_utils::sequence<I...>)
+{
+    return std::vector<int>{I...};
+}
+
+struct IsOdd
+{
+    constexpr bool operator()(std::size_t i) const
+    {
+        return i % 2 == 1;
+    }
+};
+
+struct IsBig
+{
+    constexpr bool operator()(std::size_t i) const
+    {
+        return i > 1000;
+    }
+};
 
 class TestSequence : public CppUnit::TestFixture
 {
@@ -17,6 +46,18 @@ class TestSequence : public CppUnit::TestFixture
     CPPUNIT_TEST(testMinEqMax);
     CPPUNIT_TEST(testXStepNeqMax);
     CPPUNIT_TEST(testFirstStepGtMax);
+    CPPUNIT_TEST(testReverse);
+    CPPUNIT_TEST(testReverseStep);
+    CPPUNIT_TEST(testLongSequence);
+    CPPUNIT_TEST(testIndexSequence);
+    CPPUNIT_TEST(testToIndexSequence);
+    CPPUNIT_TEST(testToSequence);
+    CPPUNIT_TEST(testCat);
+    CPPUNIT_TEST(testSlice);
+    CPPUNIT_TEST(testFilter);
+    CPPUNIT_TEST(testReverseIndices);
+    CPPUNIT_TEST(testCompose);
+    CPPUNIT_TEST(testInvert);
     CPPUNIT_TEST_SUITE_END();
 public:
     void setUp();
@@ -28,6 +69,18 @@ protected:
     void testMinEqMax();
     void testXStepNeqMax();
     void testFirstStepGtMax();
+    void testReverse();
+    void testReverseStep();
+    void testLongSequence();
+    void testIndexSequence();
+    void testToIndexSequence();
+    void testToSequence();
+    void testCat();
+    void testSlice();
+    void testFilter();
+    void testReverseIndices();
+    void testCompose();
+    void testInvert();
 };
 
 void TestSequence::setUp()
@@ -88,6 +141,143 @@ void TestSequence::testFirstStepGtMax()
     CPPUNIT_ASSERT(stream.str() == "5");
 }
 
+void TestSequence::testReverse()
+{
+    tuple_utils::make_sequence<-1, 4, -1>::type result;
+    std::ostringstream stream;
+    result.print(stream);
+
+    CPPUNIT_ASSERT(stream.str() == "4 3 2 1 0");
+}
+
+void TestSequence::testReverseStep()
+{
+    tuple_utils::make_sequence<-3, 10, -4>::type result;
+    std::ostringstream stream;
+    result.print(stream);
+
+    CPPUNIT_ASSERT(stream.str() == "10 6 2 -2");
+}
+
+void TestSequence::testLongSequence()
+{
+    auto result = toVector(tuple_utils::make_sequence<2000>::type());
+
+    CPPUNIT_ASSERT(2000 == result.size());
+    for (std::size_t i = 0; i < result.size(); ++i)
+    {
+        CPPUNIT_ASSERT(static_cast<int>(i) == result[i]);
+    }
+}
+
+void TestSequence::testIndexSequence()
+{
+    static_assert(std::is_same<tuple_utils::make_index_sequence<4>,
+                               tuple_utils::index_sequence<0, 1, 2, 3>>::value, "Type mismatch");
+    static_assert(std::is_same<tuple_utils::make_index_sequence<0>,
+                               tuple_utils::index_sequence<>>::value, "Type mismatch");
+    static_assert(std::is_same<tuple_utils::index_sequence_for<int, char, double>,
+                               tuple_utils::index_sequence<0, 1, 2>>::value, "Type mismatch");
+#if __cplusplus >= 201402L
+    static_assert(std::is_same<tuple_utils::make_index_sequence<5>, std::make_index_sequence<5>>::value,
+                  "Type mismatch");
+#endif
+
+    CPPUNIT_ASSERT(3 == tuple_utils::make_index_sequence<3>::size());
+}
+
+void TestSequence::testToIndexSequence()
+{
+    using result = tuple_utils::to_index_sequence<tuple_utils::make_sequence<9, 3, 2>::type>::type;
+    using same = tuple_utils::to_index_sequence<tuple_utils::index_sequence<2, 1>>::type;
+
+    static_assert(std::is_same<result, tuple_utils::index_sequence<3, 5, 7>>::value, "Type mismatch");
+    static_assert(std::is_same<same, tuple_utils::index_sequence<2, 1>>::value, "Type mismatch");
+    CPPUNIT_ASSERT(3 == result::size());
+}
+
+void TestSequence::testToSequence()
+{
+    tuple_utils::to_sequence<tuple_utils::index_sequence<4, 0, 2>>::type result;
+    std::ostringstream stream;
+    result.print(stream);
+
+    CPPUNIT_ASSERT(stream.str() == "4 0 2");
+}
+
+void TestSequence::testCat()
+{
+    using tuple_utils::index_sequence;
+    using result = tuple_utils::sequence_cat<index_sequence<0, 2>, index_sequence<>, index_sequence<1>>::type;
+    using single = tuple_utils::sequence_cat<index_sequence<3, 3>>::type;
+    using empty = tuple_utils::sequence_cat<>::type;
+
+    static_assert(std::is_same<result, index_sequence<0, 2, 1>>::value, "Type mismatch");
+    static_assert(std::is_same<single, index_sequence<3, 3>>::value, "Type mismatch");
+    static_assert(std::is_same<empty, index_sequence<>>::value, "Type mismatch");
+    CPPUNIT_ASSERT(3 == result::size());
+}
+
+void TestSequence::testSlice()
+{
+    using tuple_utils::index_sequence;
+    using base = index_sequence<5, 6, 7, 8>;
+
+    static_assert(std::is_same<tuple_utils::sequence_slice<base, 1, 3>::type, index_sequence<6, 7>>::value,
+                  "Type mismatch");
+    static_assert(std::is_same<tuple_utils::sequence_slice<base, 2>::type, index_sequence<7, 8>>::value,
+                  "Type mismatch");
+    static_assert(std::is_same<tuple_utils::sequence_slice<base, 4>::type, index_sequence<>>::value,
+                  "Type mismatch");
+    CPPUNIT_ASSERT(2 == (tuple_utils::sequence_slice<base, 0, 2>::type::size()));
+}
+
+void TestSequence::testFilter()
+{
+    using tuple_utils::index_sequence;
+    using result = tuple_utils::sequence_filter<index_sequence<4, 1, 3, 8, 7, 2>, IsOdd>::type;
+    using empty = tuple_utils::sequence_filter<index_sequence<4, 1, 3>, IsBig>::type;
+    using wide = tuple_utils::sequence_filter<tuple_utils::make_index_sequence<1500>, IsBig>::type;
+
+    static_assert(std::is_same<result, index_sequence<1, 3, 7>>::value, "Type mismatch");
+    static_assert(std::is_same<empty, index_sequence<>>::value, "Type mismatch");
+    static_assert(std::is_same<tuple_utils::sequence_slice<wide, 0, 2>::type, index_sequence<1001, 1002>>::value,
+                  "Type mismatch");
+    CPPUNIT_ASSERT(499 == wide::size());
+}
+
+void TestSequence::testReverseIndices()
+{
+    using tuple_utils::index_sequence;
+
+    static_assert(std::is_same<tuple_utils::sequence_reverse<index_sequence<4, 1, 2>>::type,
+                               index_sequence<2, 1, 4>>::value, "Type mismatch");
+    static_assert(std::is_same<tuple_utils::sequence_reverse<index_sequence<>>::type,
+                               index_sequence<>>::value, "Type mismatch");
+    CPPUNIT_ASSERT(3 == (tuple_utils::sequence_reverse<index_sequence<4, 1, 2>>::type::size()));
+}
+
+void TestSequence::testCompose()
+{
+    using tuple_utils::index_sequence;
+    using result = tuple_utils::sequence_compose<index_sequence<7, 8, 9>, index_sequence<2, 2, 0>>::type;
+
+    static_assert(std::is_same<result, index_sequence<9, 9, 7>>::value, "Type mismatch");
+    CPPUNIT_ASSERT(3 == result::size());
+}
+
+void TestSequence::testInvert()
+{
+    using tuple_utils::index_sequence;
+    using permutation = index_sequence<2, 0, 3, 1>;
+    using result = tuple_utils::sequence_invert<permutation>::type;
+    using identity = tuple_utils::sequence_compose<permutation, result>::type;
+
+    static_assert(std::is_same<result, index_sequence<1, 3, 0, 2>>::value, "Type mismatch");
+    static_assert(std::is_same<identity, tuple_utils::make_index_sequence<4>>::value, "Type mismatch");
+    CPPUNIT_ASSERT(4 == result::size());
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION( TestSequence );
 
 int main()
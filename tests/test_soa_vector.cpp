@@ -0,0 +1,304 @@
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <stdexcept>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestCase.h>
+#include <cppunit/TestFixture.h>
+#include "../src/soa_vector.hpp"
+#include "../src/explode.hpp"
+#include "../src/fold_tuples.hpp"
+#include "../src/zip_tuples.hpp"
+
+/**
+ * @brief Element type which throws from its constructor for a chosen value
+ */
+struct ThrowOn
+{
+    explicit ThrowOn(int v) : value(v)
+    {
+        if (v < 0)
+        {
+            throw std::runtime_error("negative");
+        }
+    }
+
+    int value;
+};
+
+class TestSoaVector : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestSoaVector);
+    CPPUNIT_TEST(testPushBack);
+    CPPUNIT_TEST(testEmplaceBack);
+    CPPUNIT_TEST(testMoveOnly);
+    CPPUNIT_TEST(testColumns);
+    CPPUNIT_TEST(testAlignment);
+    CPPUNIT_TEST(testIterate);
+    CPPUNIT_TEST(testConst);
+    CPPUNIT_TEST(testRows);
+    CPPUNIT_TEST(testExplodeFoldZip);
+    CPPUNIT_TEST(testClearPop);
+    CPPUNIT_TEST(testStrongGuarantee);
+    CPPUNIT_TEST(testSelfAliasing);
+    CPPUNIT_TEST(testFlags);
+    CPPUNIT_TEST_SUITE_END();
+public:
+    void setUp();
+    void tearDown();
+protected:
+    void testPushBack();
+    void testEmplaceBack();
+    void testMoveOnly();
+    void testColumns();
+    void testAlignment();
+    void testIterate();
+    void testConst();
+    void testRows();
+    void testExplodeFoldZip();
+    void testClearPop();
+    void testStrongGuarantee();
+    void testSelfAliasing();
+    void testFlags();
+};
+
+void TestSoaVector::setUp()
+{}
+
+void TestSoaVector::tearDown()
+{}
+
+void TestSoaVector::testPushBack()
+{
+    tuple_utils::soa_vector<int, std::string> values;
+    auto row = std::make_tuple(2, std::string("b"));
+    values.push_back(std::make_tuple(1, std::string("a")));
+    values.push_back(row);
+
+    static_assert(std::is_same<decltype(values[0]), std::tuple<int&, std::string&>>::value, "Type mismatch");
+
+    CPPUNIT_ASSERT(2 == values.size());
+    CPPUNIT_ASSERT(!values.empty());
+    CPPUNIT_ASSERT(std::make_tuple(1, std::string("a")) == values[0]);
+    CPPUNIT_ASSERT(std::make_tuple(2, std::string("b")) == values[1]);
+    CPPUNIT_ASSERT("b" == std::get<1>(row));
+}
+
+void TestSoaVector::testEmplaceBack()
+{
+    tuple_utils::soa_vector<std::string, std::vector<int>> values;
+    values.emplace_back("abc", 3);
+    values.emplace_back(std::string(2, 'x'), std::vector<int>({1, 2}));
+
+    CPPUNIT_ASSERT(std::make_tuple(std::string("abc"), std::vector<int>(3)) == values.front());
+    CPPUNIT_ASSERT(std::make_tuple(std::string("xx"), std::vector<int>({1, 2})) == values.back());
+}
+
+void TestSoaVector::testMoveOnly()
+{
+    tuple_utils::soa_vector<std::unique_ptr<int>, int> values;
+    auto row = std::make_tuple(std::unique_ptr<int>(new int(5)), 1);
+    values.push_back(std::move(row));
+
+    CPPUNIT_ASSERT(nullptr == std::get<0>(row));
+    CPPUNIT_ASSERT(5 == *std::get<0>(values[0]));
+}
+
+void TestSoaVector::testColumns()
+{
+    tuple_utils::soa_vector<int, double> values;
+    for (int i = 0; i < 100; ++i)
+    {
+        values.emplace_back(i, i * 0.5);
+    }
+
+    auto column = values.column<1>();
+    static_assert(std::is_same<decltype(column), tuple_utils::column_span<double>>::value, "Type mismatch");
+
+    CPPUNIT_ASSERT(100 == column.size());
+    double sum = 0;
+    for (double x : column)
+    {
+        sum += x;
+    }
+    CPPUNIT_ASSERT(2475.0 == sum);
+
+    column[3] = -1;
+    CPPUNIT_ASSERT(-1 == std::get<1>(values[3]));
+    CPPUNIT_ASSERT(&values.column<0>()[7] == &std::get<0>(values[7]));
+
+    auto all = values.all_columns();
+    CPPUNIT_ASSERT(values.column<0>().data() == std::get<0>(all).data());
+    CPPUNIT_ASSERT(100 == std::get<1>(all).size());
+}
+
+void TestSoaVector::testAlignment()
+{
+    tuple_utils::soa_vector<char, int, double> values;
+    for (int i = 0; i < 10; ++i)
+    {
+        values.emplace_back('a', i, 0.5);
+        CPPUNIT_ASSERT(0 == reinterpret_cast<std::uintptr_t>(values.column<0>().data()) % tuple_utils::cache_line_size);
+        CPPUNIT_ASSERT(0 == reinterpret_cast<std::uintptr_t>(values.column<1>().data()) % tuple_utils::cache_line_size);
+        CPPUNIT_ASSERT(0 == reinterpret_cast<std::uintptr_t>(values.column<2>().data()) % tuple_utils::cache_line_size);
+    }
+}
+
+void TestSoaVector::testIterate()
+{
+    tuple_utils::soa_vector<int, double> values;
+    values.emplace_back(1, 0.5);
+    values.emplace_back(2, 1.5);
+
+    for (auto row : values)
+    {
+        std::get<1>(row) *= std::get<0>(row);
+    }
+
+    CPPUNIT_ASSERT(std::make_tuple(1, 0.5) == values[0]);
+    CPPUNIT_ASSERT(std::make_tuple(2, 3.0) == values[1]);
+    CPPUNIT_ASSERT(2 == values.end() - values.begin());
+}
+
+void TestSoaVector::testConst()
+{
+    tuple_utils::soa_vector<int, std::string> values;
+    values.emplace_back(1, "a");
+    const auto& view = values;
+
+    static_assert(std::is_same<decltype(view[0]), std::tuple<const int&, const std::string&>>::value,
+                  "Type mismatch");
+    static_assert(std::is_same<decltype(view.column<1>()), tuple_utils::column_span<const std::string>>::value,
+                  "Type mismatch");
+
+    int count = 0;
+    for (auto row : view)
+    {
+        count += std::get<0>(row);
+    }
+    CPPUNIT_ASSERT(1 == count);
+    CPPUNIT_ASSERT("a" == view.column<1>()[0]);
+}
+
+void TestSoaVector::testRows()
+{
+    std::vector<std::tuple<int, std::string>> rows = {
+        std::make_tuple(1, std::string("a")),
+        std::make_tuple(2, std::string("b")),
+        std::make_tuple(3, std::string("c"))
+    };
+    tuple_utils::soa_vector<int, std::string> values(rows);
+
+    CPPUNIT_ASSERT(3 == values.size());
+    CPPUNIT_ASSERT(rows == values.rows());
+
+    values.append(std::move(rows));
+    CPPUNIT_ASSERT(6 == values.size());
+    CPPUNIT_ASSERT(std::make_tuple(3, std::string("c")) == values[5]);
+}
+
+void TestSoaVector::testExplodeFoldZip()
+{
+    tuple_utils::soa_vector<int, int> values;
+    values.emplace_back(1, 2);
+    values.emplace_back(3, 4);
+
+    CPPUNIT_ASSERT(2 == tuple_utils::explode([](int x, int y) { return x * y; }, values[0]));
+
+    auto sum = tuple_utils::fold([](int x, int y) { return x + y; }, values[0], values[1]);
+    CPPUNIT_ASSERT(std::make_tuple(4, 6) == sum);
+
+    auto zipped = tuple_utils::zip(values[0], values[1]);
+    CPPUNIT_ASSERT(std::make_tuple(std::make_tuple(1, 3), std::make_tuple(2, 4)) == zipped);
+}
+
+void TestSoaVector::testClearPop()
+{
+    tuple_utils::soa_vector<int, std::string> values;
+    values.emplace_back(1, "a");
+    values.emplace_back(2, "b");
+    values.pop_back();
+
+    CPPUNIT_ASSERT(1 == values.size());
+    CPPUNIT_ASSERT(1 == values.column<1>().size());
+
+    values.clear();
+    CPPUNIT_ASSERT(values.empty());
+    CPPUNIT_ASSERT(values.begin() == values.end());
+}
+
+void TestSoaVector::testStrongGuarantee()
+{
+    tuple_utils::soa_vector<std::string, ThrowOn> values;
+    values.emplace_back("a", 1);
+
+    bool thrown = false;
+    try
+    {
+        values.emplace_back("b", -1);
+    }
+    catch (const std::runtime_error&)
+    {
+        thrown = true;
+    }
+
+    CPPUNIT_ASSERT(thrown);
+    CPPUNIT_ASSERT(1 == values.size());
+    CPPUNIT_ASSERT(1 == values.column<0>().size());
+    CPPUNIT_ASSERT("a" == values.column<0>()[0]);
+}
+
+void TestSoaVector::testSelfAliasing()
+{
+    tuple_utils::soa_vector<int, std::string> values;
+    const std::string text(100, 'a');
+    values.emplace_back(1, text);
+
+    //rows referring to elements of values stay valid while columns are reallocated, as with std::vector
+    for (int i = 0; i < 10; ++i)
+    {
+        values.push_back(values[0]);
+        values.emplace_back(std::get<0>(values.back()) + 1, std::get<1>(values[0]));
+    }
+
+    CPPUNIT_ASSERT(21 == values.size());
+    CPPUNIT_ASSERT(std::make_tuple(1, text) == values[19]);
+    CPPUNIT_ASSERT(std::make_tuple(2, text) == values[20]);
+}
+
+void TestSoaVector::testFlags()
+{
+    //soa_vector<int, bool> is rejected by static_assert, flags are kept in a byte column
+    static_assert(tuple_utils::details::has_bool_column<int, const bool>::value, "bool column not detected");
+    static_assert(!tuple_utils::details::has_bool_column<int, std::uint8_t, char>::value, "Unexpected bool column");
+    static_assert(tuple_utils::details::has_bool_column<bool>::value, "bool column not detected");
+    static_assert(!tuple_utils::details::has_bool_column<>::value, "Unexpected bool column");
+
+    tuple_utils::soa_vector<int, std::uint8_t> values;
+    values.emplace_back(1, true);
+    values.emplace_back(2, false);
+    values.emplace_back(3, true);
+
+    int sum = 0;
+    for (auto row : values)
+    {
+        sum += std::get<1>(row) ? std::get<0>(row) : 0;
+    }
+    CPPUNIT_ASSERT(4 == sum);
+    CPPUNIT_ASSERT(values.column<1>().data() + 1 == &values.column<1>()[1]);
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestSoaVector );
+
+int main()
+{
+    CppUnit::TextUi::TestRunner runner;
+    CppUnit::TestFactoryRegistry &registry = CppUnit::TestFactoryRegistry::getRegistry();
+    runner.addTest(registry.makeTest());
+    bool wasSuccessful = runner.run("", false);
+    return wasSuccessful;
+}
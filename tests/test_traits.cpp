@@ -0,0 +1,132 @@
+#include "../src/aux/traits.hpp"
+#include <tuple>
+#include <string>
+#include <utility>
+#include <type_traits>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestCase.h>
+#include <cppunit/TestFixture.h>
+
+template <std::size_t... I>
+std::tuple<std::integral_constant<std::size_t, I>...> makeTuple(tuple_utils::index_sequence<I...>);
+
+template <std::size_t N>
+using TupleOf = decltype(makeTuple(tuple_utils::make_index_sequence<N>()));
+
+template <std::size_t... I>
+tuple_utils::tsize_min<TupleOf<I + 3>...> makeManyMin(tuple_utils::index_sequence<I...>);
+
+template <std::size_t... I>
+tuple_utils::tsize_sum<TupleOf<I>...> makeManySum(tuple_utils::index_sequence<I...>);
+
+class TestTraits : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestTraits);
+    CPPUNIT_TEST(testMin);
+    CPPUNIT_TEST(testMax);
+    CPPUNIT_TEST(testSum);
+    CPPUNIT_TEST(testProduct);
+    CPPUNIT_TEST(testContainEmpty);
+    CPPUNIT_TEST(testManyArguments);
+    CPPUNIT_TEST_SUITE_END();
+public:
+    void setUp();
+    void tearDown();
+protected:
+    void testMin();
+    void testMax();
+    void testSum();
+    void testProduct();
+    void testContainEmpty();
+    void testManyArguments();
+};
+
+void TestTraits::setUp()
+{}
+
+void TestTraits::tearDown()
+{}
+
+void TestTraits::testMin()
+{
+    using one = std::tuple<int>;
+    using three = std::tuple<int, std::string, double>;
+    using pair = std::pair<int, int>;
+
+    static_assert(tuple_utils::tsize_min<three>::value == 3, "Wrong size");
+    static_assert(tuple_utils::tsize_min<three, const one&>::value == 1, "Wrong size");
+    static_assert(tuple_utils::tsize_min<three, pair&&, three>::value == 2, "Wrong size");
+    static_assert(tuple_utils::tsize_min<three, std::tuple<>, one>::value == 0, "Wrong size");
+    CPPUNIT_ASSERT(2 == (tuple_utils::tsize_min<pair, three>::value));
+}
+
+void TestTraits::testMax()
+{
+    using one = std::tuple<int>;
+    using three = std::tuple<int, std::string, double>;
+
+    static_assert(tuple_utils::tsize_max<>::value == 0, "Wrong size");
+    static_assert(tuple_utils::tsize_max<one>::value == 1, "Wrong size");
+    static_assert(tuple_utils::tsize_max<one, three&, std::tuple<>>::value == 3, "Wrong size");
+    CPPUNIT_ASSERT(3 == (tuple_utils::tsize_max<three, one>::value));
+}
+
+void TestTraits::testSum()
+{
+    using one = std::tuple<int>;
+    using three = std::tuple<int, std::string, double>;
+
+    static_assert(tuple_utils::tsize_sum<>::value == 0, "Wrong size");
+    static_assert(tuple_utils::tsize_sum<std::tuple<>>::value == 0, "Wrong size");
+    static_assert(tuple_utils::tsize_sum<one, const three&, std::tuple<>, one>::value == 5, "Wrong size");
+    CPPUNIT_ASSERT(4 == (tuple_utils::tsize_sum<three, one>::value));
+}
+
+void TestTraits::testProduct()
+{
+    using two = std::tuple<int, char>;
+    using three = std::tuple<int, std::string, double>;
+    using indices = tuple_utils::details::product_indices<4, 2, 3>;
+
+    static_assert(tuple_utils::tsize_product<>::value == 1, "Wrong size");
+    static_assert(tuple_utils::tsize_product<two, const three&>::value == 6, "Wrong size");
+    static_assert(tuple_utils::tsize_product<two, std::tuple<>, three>::value == 0, "Wrong size");
+    static_assert(std::is_same<indices::coordinates, tuple_utils::index_sequence<1, 1>>::value, "Wrong coordinates");
+    static_assert(std::is_same<indices::last_use, tuple_utils::index_sequence<0, 1>>::value, "Wrong last use");
+    static_assert(std::is_same<tuple_utils::details::product_indices<5, 2, 3>::last_use,
+                               tuple_utils::index_sequence<1, 1>>::value, "Wrong last use");
+    CPPUNIT_ASSERT(6 == (tuple_utils::tsize_product<three, two>::value));
+}
+
+void TestTraits::testContainEmpty()
+{
+    using one = std::tuple<int>;
+
+    static_assert(tuple_utils::contain_empty<one>::value == false, "Wrong value");
+    static_assert(tuple_utils::contain_empty<std::tuple<>>::value == true, "Wrong value");
+    static_assert(tuple_utils::contain_empty<one, one, const std::tuple<>&>::value == true, "Wrong value");
+    CPPUNIT_ASSERT(false == (tuple_utils::contain_empty<one, one>::value));
+}
+
+void TestTraits::testManyArguments()
+{
+    using min = decltype(makeManyMin(tuple_utils::make_index_sequence<600>()));
+    using sum = decltype(makeManySum(tuple_utils::make_index_sequence<600>()));
+
+    static_assert(min::value == 3, "Wrong size");
+    static_assert(sum::value == 599 * 600 / 2, "Wrong size");
+    CPPUNIT_ASSERT(3 == min::value);
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestTraits );
+
+int main()
+{
+    CppUnit::TextUi::TestRunner runner;
+    CppUnit::TestFactoryRegistry &registry = CppUnit::TestFactoryRegistry::getRegistry();
+    runner.addTest(registry.makeTest());
+    bool wasSuccessful = runner.run("", false);
+    return wasSuccessful;
+}
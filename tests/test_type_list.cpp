@@ -0,0 +1,163 @@
+#include "../src/aux/type_list.hpp"
+#include <tuple>
+#include <string>
+#include <type_traits>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestCase.h>
+#include <cppunit/TestFixture.h>
+
+template <std::size_t... I>
+tuple_utils::type_list<std::integral_constant<std::size_t, I>...> makeWideList(tuple_utils::index_sequence<I...>);
+
+using WideList = decltype(makeWideList(tuple_utils::make_index_sequence<900>()));
+
+class TestTypeList : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestTypeList);
+    CPPUNIT_TEST(testTypeAt);
+    CPPUNIT_TEST(testTypeAtWide);
+    CPPUNIT_TEST(testTupleTypeAt);
+    CPPUNIT_TEST(testConversions);
+    CPPUNIT_TEST(testCat);
+    CPPUNIT_TEST(testCatEmpty);
+    CPPUNIT_TEST(testCatWide);
+    CPPUNIT_TEST(testProduct);
+    CPPUNIT_TEST_SUITE_END();
+public:
+    void setUp();
+    void tearDown();
+protected:
+    void testTypeAt();
+    void testTypeAtWide();
+    void testTupleTypeAt();
+    void testConversions();
+    void testCat();
+    void testCatEmpty();
+    void testCatWide();
+    void testProduct();
+};
+
+void TestTypeList::setUp()
+{}
+
+void TestTypeList::tearDown()
+{}
+
+void TestTypeList::testTypeAt()
+{
+    using list = tuple_utils::type_list<int, const char*, double&, int>;
+
+    static_assert(std::is_same<tuple_utils::type_at<0, list>::type, int>::value, "Type mismatch");
+    static_assert(std::is_same<tuple_utils::type_at<1, list>::type, const char*>::value, "Type mismatch");
+    static_assert(std::is_same<tuple_utils::type_at<2, list>::type, double&>::value, "Type mismatch");
+    static_assert(std::is_same<tuple_utils::type_at<3, list>::type, int>::value, "Type mismatch");
+    CPPUNIT_ASSERT(4 == list::size);
+}
+
+void TestTypeList::testTypeAtWide()
+{
+    using first = tuple_utils::type_at<0, WideList>::type;
+    using middle = tuple_utils::type_at<700, WideList>::type;
+    using last = tuple_utils::type_at<899, WideList>::type;
+
+    static_assert(std::is_same<first, std::integral_constant<std::size_t, 0>>::value, "Type mismatch");
+    static_assert(std::is_same<middle, std::integral_constant<std::size_t, 700>>::value, "Type mismatch");
+    static_assert(std::is_same<last, std::integral_constant<std::size_t, 899>>::value, "Type mismatch");
+    CPPUNIT_ASSERT(900 == WideList::size);
+}
+
+void TestTypeList::testTupleTypeAt()
+{
+    using tuple = std::tuple<int, std::string, long>;
+
+    static_assert(std::is_same<tuple_utils::tuple_type_at<1, tuple>::type, std::string>::value, "Type mismatch");
+    static_assert(std::is_same<tuple_utils::tuple_type_at<2, tuple&>::type, long>::value, "Type mismatch");
+    static_assert(std::is_same<tuple_utils::tuple_type_at<0, const tuple&>::type, const int>::value, "Type mismatch");
+    static_assert(std::is_same<tuple_utils::tuple_type_at<1, std::pair<int, char>>::type, char>::value,
+                  "Type mismatch");
+    CPPUNIT_ASSERT(3 == tuple_utils::to_type_list<tuple>::type::size);
+}
+
+void TestTypeList::testConversions()
+{
+    using list = tuple_utils::to_type_list<std::tuple<int, char>>::type;
+
+    static_assert(std::is_same<list, tuple_utils::type_list<int, char>>::value, "Type mismatch");
+    static_assert(std::is_same<tuple_utils::to_tuple<list>::type, std::tuple<int, char>>::value, "Type mismatch");
+    static_assert(std::is_same<tuple_utils::to_type_list<list>::type, list>::value, "Type mismatch");
+    CPPUNIT_ASSERT(2 == list::size);
+}
+
+void TestTypeList::testCat()
+{
+    using result = tuple_utils::type_list_cat<
+        tuple_utils::type_list<int, char>,
+        tuple_utils::type_list<>,
+        tuple_utils::type_list<double>,
+        tuple_utils::type_list<std::string, int>
+    >::type;
+
+    static_assert(std::is_same<result, tuple_utils::type_list<int, char, double, std::string, int>>::value,
+                  "Type mismatch");
+    CPPUNIT_ASSERT(5 == result::size);
+}
+
+void TestTypeList::testCatEmpty()
+{
+    using none = tuple_utils::type_list_cat<>::type;
+    using empty = tuple_utils::type_list_cat<tuple_utils::type_list<>, tuple_utils::type_list<>>::type;
+
+    static_assert(std::is_same<none, tuple_utils::type_list<>>::value, "Type mismatch");
+    static_assert(std::is_same<empty, tuple_utils::type_list<>>::value, "Type mismatch");
+    CPPUNIT_ASSERT(0 == none::size);
+}
+
+void TestTypeList::testCatWide()
+{
+    using result = tuple_utils::type_list_cat<tuple_utils::type_list<char>, WideList, WideList>::type;
+
+    static_assert(std::is_same<tuple_utils::type_at<0, result>::type, char>::value, "Type mismatch");
+    static_assert(std::is_same<tuple_utils::type_at<900, result>::type,
+                               std::integral_constant<std::size_t, 899>>::value, "Type mismatch");
+    static_assert(std::is_same<tuple_utils::type_at<901, result>::type,
+                               std::integral_constant<std::size_t, 0>>::value, "Type mismatch");
+    CPPUNIT_ASSERT(1801 == result::size);
+}
+
+void TestTypeList::testProduct()
+{
+    using result = tuple_utils::type_list_product<
+        tuple_utils::type_list<int, char>,
+        tuple_utils::type_list<double>,
+        tuple_utils::type_list<std::string, float, long>
+    >::type;
+
+    static_assert(std::is_same<tuple_utils::type_at<0, result>::type,
+                               tuple_utils::type_list<int, double, std::string>>::value, "Type mismatch");
+    static_assert(std::is_same<tuple_utils::type_at<2, result>::type,
+                               tuple_utils::type_list<int, double, long>>::value, "Type mismatch");
+    static_assert(std::is_same<tuple_utils::type_at<4, result>::type,
+                               tuple_utils::type_list<char, double, float>>::value, "Type mismatch");
+    CPPUNIT_ASSERT(6 == result::size);
+
+    using none = tuple_utils::type_list_product<tuple_utils::type_list<int>, tuple_utils::type_list<>>::type;
+    using single = tuple_utils::type_list_product<tuple_utils::type_list<int, char>>::type;
+
+    static_assert(std::is_same<none, tuple_utils::type_list<>>::value, "Type mismatch");
+    static_assert(std::is_same<single, tuple_utils::type_list<tuple_utils::type_list<int>,
+                                                              tuple_utils::type_list<char>>>::value,
+                  "Type mismatch");
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestTypeList );
+
+int main()
+{
+    CppUnit::TextUi::TestRunner runner;
+    CppUnit::TestFactoryRegistry &registry = CppUnit::TestFactoryRegistry::getRegistry();
+    runner.addTest(registry.makeTest());
+    bool wasSuccessful = runner.run("", false);
+    return wasSuccessful;
+}
@@ -0,0 +1,164 @@
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestCase.h>
+#include <cppunit/TestFixture.h>
+#include "../src/unzip.hpp"
+
+class TestUnzip : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestUnzip);
+    CPPUNIT_TEST(testUnzipTrivial);
+    CPPUNIT_TEST(testUnzipNonTrivial);
+    CPPUNIT_TEST(testUnzipEmpty);
+    CPPUNIT_TEST(testUnzipRvalue);
+    CPPUNIT_TEST(testZipColumnsTrivial);
+    CPPUNIT_TEST(testZipColumnsNonTrivial);
+    CPPUNIT_TEST(testZipColumnsShortest);
+    CPPUNIT_TEST(testZipColumnsRvalue);
+    CPPUNIT_TEST(testRoundTrip);
+    CPPUNIT_TEST_SUITE_END();
+public:
+    void setUp();
+    void tearDown();
+protected:
+    void testUnzipTrivial();
+    void testUnzipNonTrivial();
+    void testUnzipEmpty();
+    void testUnzipRvalue();
+    void testZipColumnsTrivial();
+    void testZipColumnsNonTrivial();
+    void testZipColumnsShortest();
+    void testZipColumnsRvalue();
+    void testRoundTrip();
+};
+
+void TestUnzip::setUp()
+{}
+
+void TestUnzip::tearDown()
+{}
+
+void TestUnzip::testUnzipTrivial()
+{
+    std::vector<std::tuple<int, double, char>> rows = {
+        std::make_tuple(1, 0.5, 'a'),
+        std::make_tuple(2, 1.5, 'b'),
+        std::make_tuple(3, 2.5, 'c')
+    };
+    auto result = tuple_utils::unzip(rows);
+
+    static_assert(std::is_same<decltype(result),
+                               std::tuple<std::vector<int>, std::vector<double>, std::vector<char>>
+                              >::value, "Type mismatch");
+
+    CPPUNIT_ASSERT(std::vector<int>({1, 2, 3}) == std::get<0>(result));
+    CPPUNIT_ASSERT(std::vector<double>({0.5, 1.5, 2.5}) == std::get<1>(result));
+    CPPUNIT_ASSERT(std::vector<char>({'a', 'b', 'c'}) == std::get<2>(result));
+    CPPUNIT_ASSERT(3 == rows.size());
+}
+
+void TestUnzip::testUnzipNonTrivial()
+{
+    std::vector<std::tuple<std::string, int>> rows = {
+        std::make_tuple(std::string("x"), 1),
+        std::make_tuple(std::string("y"), 2)
+    };
+    auto result = tuple_utils::unzip(rows);
+
+    CPPUNIT_ASSERT(std::vector<std::string>({"x", "y"}) == std::get<0>(result));
+    CPPUNIT_ASSERT(std::vector<int>({1, 2}) == std::get<1>(result));
+    CPPUNIT_ASSERT("x" == std::get<0>(rows[0]));
+}
+
+void TestUnzip::testUnzipEmpty()
+{
+    std::vector<std::tuple<int, std::string>> rows;
+    auto result = tuple_utils::unzip(rows);
+
+    CPPUNIT_ASSERT(std::get<0>(result).empty());
+    CPPUNIT_ASSERT(std::get<1>(result).empty());
+}
+
+void TestUnzip::testUnzipRvalue()
+{
+    std::vector<std::tuple<std::unique_ptr<int>, std::string>> rows;
+    rows.emplace_back(std::unique_ptr<int>(new int(1)), std::string("a"));
+    rows.emplace_back(std::unique_ptr<int>(new int(2)), std::string("b"));
+    auto result = tuple_utils::unzip(std::move(rows));
+
+    CPPUNIT_ASSERT(2 == std::get<0>(result).size());
+    CPPUNIT_ASSERT(1 == *std::get<0>(result)[0]);
+    CPPUNIT_ASSERT(2 == *std::get<0>(result)[1]);
+    CPPUNIT_ASSERT(std::vector<std::string>({"a", "b"}) == std::get<1>(result));
+}
+
+void TestUnzip::testZipColumnsTrivial()
+{
+    auto columns = std::make_tuple(std::vector<int>({1, 2}), std::vector<double>({0.5, 1.5}));
+    auto result = tuple_utils::zip_columns(columns);
+
+    static_assert(std::is_same<decltype(result), std::vector<std::tuple<int, double>>>::value, "Type mismatch");
+
+    CPPUNIT_ASSERT(2 == result.size());
+    CPPUNIT_ASSERT(std::make_tuple(1, 0.5) == result[0]);
+    CPPUNIT_ASSERT(std::make_tuple(2, 1.5) == result[1]);
+}
+
+void TestUnzip::testZipColumnsNonTrivial()
+{
+    const auto columns = std::make_tuple(std::vector<std::string>({"a", "b"}), std::vector<int>({1, 2}));
+    auto result = tuple_utils::zip_columns(columns);
+
+    CPPUNIT_ASSERT(std::make_tuple(std::string("a"), 1) == result[0]);
+    CPPUNIT_ASSERT(std::make_tuple(std::string("b"), 2) == result[1]);
+    CPPUNIT_ASSERT("a" == std::get<0>(columns)[0]);
+}
+
+void TestUnzip::testZipColumnsShortest()
+{
+    auto columns = std::make_tuple(std::vector<int>({1, 2, 3}), std::vector<char>({'a', 'b'}),
+                                   std::vector<std::string>({"x", "y", "z", "w"}));
+    auto result = tuple_utils::zip_columns(columns);
+
+    CPPUNIT_ASSERT(2 == result.size());
+    CPPUNIT_ASSERT(std::make_tuple(2, 'b', std::string("y")) == result[1]);
+}
+
+void TestUnzip::testZipColumnsRvalue()
+{
+    std::vector<std::unique_ptr<int>> pointers;
+    pointers.emplace_back(new int(1));
+    pointers.emplace_back(new int(2));
+    auto result = tuple_utils::zip_columns(std::make_tuple(std::move(pointers), std::vector<int>({3, 4})));
+
+    CPPUNIT_ASSERT(2 == result.size());
+    CPPUNIT_ASSERT(1 == *std::get<0>(result[0]));
+    CPPUNIT_ASSERT(4 == std::get<1>(result[1]));
+}
+
+void TestUnzip::testRoundTrip()
+{
+    std::vector<std::tuple<int, std::string, float>> rows = {
+        std::make_tuple(1, std::string("a"), 0.5f),
+        std::make_tuple(2, std::string("b"), 1.5f),
+        std::make_tuple(3, std::string("c"), 2.5f)
+    };
+
+    CPPUNIT_ASSERT(rows == tuple_utils::zip_columns(tuple_utils::unzip(rows)));
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestUnzip );
+
+int main()
+{
+    CppUnit::TextUi::TestRunner runner;
+    CppUnit::TestFactoryRegistry &registry = CppUnit::TestFactoryRegistry::getRegistry();
+    runner.addTest(registry.makeTest());
+    bool wasSuccessful = runner.run("", false);
+    return wasSuccessful;
+}
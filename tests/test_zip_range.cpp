@@ -0,0 +1,226 @@
+#include <tuple>
+#include <string>
+#include <vector>
+#include <array>
+#include <deque>
+#include <iterator>
+#include <algorithm>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestCase.h>
+#include <cppunit/TestFixture.h>
+#include "../src/zip_range.hpp"
+#include "../src/explode.hpp"
+
+class TestZipRange : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestZipRange);
+    CPPUNIT_TEST(testIterate);
+    CPPUNIT_TEST(testModify);
+    CPPUNIT_TEST(testShortest);
+    CPPUNIT_TEST(testEmpty);
+    CPPUNIT_TEST(testConst);
+    CPPUNIT_TEST(testRvalueContainer);
+    CPPUNIT_TEST(testMixedContainers);
+    CPPUNIT_TEST(testRandomAccess);
+    CPPUNIT_TEST(testExplodeRow);
+    CPPUNIT_TEST(testAlgorithms);
+    CPPUNIT_TEST_SUITE_END();
+public:
+    void setUp();
+    void tearDown();
+protected:
+    void testIterate();
+    void testModify();
+    void testShortest();
+    void testEmpty();
+    void testConst();
+    void testRvalueContainer();
+    void testMixedContainers();
+    void testRandomAccess();
+    void testExplodeRow();
+    void testAlgorithms();
+};
+
+void TestZipRange::setUp()
+{}
+
+void TestZipRange::tearDown()
+{}
+
+void TestZipRange::testIterate()
+{
+    std::vector<int> x = {1, 2, 3};
+    std::vector<std::string> y = {"a", "b", "c"};
+    auto range = tuple_utils::zip_range(x, y);
+
+    static_assert(std::is_same<decltype(*range.begin()), std::tuple<int&, std::string&>>::value, "Type mismatch");
+
+    CPPUNIT_ASSERT(3 == range.size());
+    std::string result;
+    for (auto row : range)
+    {
+        result += std::to_string(std::get<0>(row)) + std::get<1>(row);
+    }
+    CPPUNIT_ASSERT("1a2b3c" == result);
+    CPPUNIT_ASSERT(&x[1] == &std::get<0>(range[1]));
+    CPPUNIT_ASSERT(&y[2] == &std::get<1>(range[2]));
+}
+
+void TestZipRange::testModify()
+{
+    std::vector<float> x = {1, 2, 3};
+    std::vector<float> y = {4, 5, 6};
+    std::vector<float> sum(3);
+
+    for (auto row : tuple_utils::zip_range(x, y, sum))
+    {
+        std::get<2>(row) = std::get<0>(row) + std::get<1>(row);
+    }
+
+    CPPUNIT_ASSERT(std::vector<float>({5, 7, 9}) == sum);
+    CPPUNIT_ASSERT(std::vector<float>({1, 2, 3}) == x);
+}
+
+void TestZipRange::testShortest()
+{
+    std::vector<int> x = {1, 2, 3, 4};
+    std::vector<int> y = {5, 6};
+    std::vector<int> z = {7, 8, 9};
+    auto range = tuple_utils::zip_range(x, y, z);
+
+    CPPUNIT_ASSERT(2 == range.size());
+    CPPUNIT_ASSERT(2 == std::distance(range.begin(), range.end()));
+    CPPUNIT_ASSERT(std::make_tuple(2, 6, 8) == *std::next(range.begin()));
+}
+
+void TestZipRange::testEmpty()
+{
+    std::vector<int> x = {1, 2, 3};
+    std::vector<int> y;
+    auto range = tuple_utils::zip_range(x, y);
+
+    CPPUNIT_ASSERT(range.empty());
+    CPPUNIT_ASSERT(range.begin() == range.end());
+}
+
+void TestZipRange::testConst()
+{
+    const std::vector<int> x = {1, 2};
+    std::vector<int> y = {3, 4};
+    const auto range = tuple_utils::zip_range(x, y);
+
+    static_assert(std::is_same<decltype(*range.begin()), std::tuple<const int&, const int&>>::value,
+                  "Type mismatch");
+    static_assert(std::is_same<decltype(range[0]), std::tuple<const int&, const int&>>::value,
+                  "Type mismatch");
+
+    CPPUNIT_ASSERT(std::make_tuple(1, 3) == range[0]);
+    CPPUNIT_ASSERT(std::make_tuple(2, 4) == range[1]);
+}
+
+void TestZipRange::testRvalueContainer()
+{
+    std::vector<int> x = {1, 2, 3};
+    auto range = tuple_utils::zip_range(x, std::vector<int>({4, 5, 6}));
+
+    int sum = 0;
+    for (auto row : range)
+    {
+        sum += std::get<0>(row) * std::get<1>(row);
+    }
+    CPPUNIT_ASSERT(32 == sum);
+}
+
+void TestZipRange::testMixedContainers()
+{
+    int x[] = {1, 2, 3};
+    std::array<double, 4> y = {{0.5, 1.5, 2.5, 3.5}};
+    std::deque<char> z = {'a', 'b', 'c'};
+    auto range = tuple_utils::zip_range(x, y, z);
+
+    static_assert(std::is_same<decltype(range[0]), std::tuple<int&, double&, char&>>::value, "Type mismatch");
+
+    CPPUNIT_ASSERT(3 == range.size());
+    CPPUNIT_ASSERT(std::make_tuple(3, 2.5, 'c') == range[2]);
+}
+
+void TestZipRange::testRandomAccess()
+{
+    std::vector<int> x = {1, 2, 3, 4, 5};
+    std::vector<int> y = {6, 7, 8, 9, 10};
+    auto range = tuple_utils::zip_range(x, y);
+    auto it = range.begin();
+
+    static_assert(std::is_same<std::iterator_traits<decltype(it)>::iterator_category,
+                               std::input_iterator_tag>::value, "Category mismatch");
+    static_assert(std::is_same<decltype(it)::iterator_concept,
+                               std::random_access_iterator_tag>::value, "Concept mismatch");
+
+    it += 3;
+    CPPUNIT_ASSERT(std::make_tuple(4, 9) == *it);
+    CPPUNIT_ASSERT(std::make_tuple(2, 7) == it[-2]);
+    CPPUNIT_ASSERT(std::make_tuple(3, 8) == *(it - 1));
+    CPPUNIT_ASSERT(std::make_tuple(5, 10) == *(1 + it));
+    CPPUNIT_ASSERT(range.end() - it == 2);
+    CPPUNIT_ASSERT(range.begin() < it && it <= range.end() && range.end() > it);
+
+    auto reversed = std::reverse_iterator<decltype(it)>(range.end());
+    CPPUNIT_ASSERT(std::make_tuple(5, 10) == *reversed);
+
+    auto found = std::find_if(range.begin(), range.end(),
+                              [](std::tuple<int&, int&> row) { return std::get<1>(row) == 8; });
+    CPPUNIT_ASSERT(2 == found - range.begin());
+}
+
+void TestZipRange::testExplodeRow()
+{
+    std::vector<int> x = {1, 2};
+    std::vector<int> y = {3, 4};
+    std::vector<int> result;
+
+    for (auto row : tuple_utils::zip_range(x, y))
+    {
+        result.push_back(tuple_utils::explode([](int a, int b) { return a * b; }, row));
+    }
+    CPPUNIT_ASSERT(std::vector<int>({3, 8}) == result);
+}
+
+void TestZipRange::testAlgorithms()
+{
+    std::vector<int> x = {1, 2, 3, 4};
+    std::vector<int> y = {5, 6, 7, 8};
+    std::vector<int> sum(4);
+    auto range = tuple_utils::zip_range(x, y, sum);
+
+    std::for_each(range.begin(), range.end(),
+                  [](std::tuple<int&, int&, int&> row) { std::get<2>(row) = std::get<0>(row) + std::get<1>(row); });
+    CPPUNIT_ASSERT(std::vector<int>({6, 8, 10, 12}) == sum);
+
+    auto odd = std::count_if(range.begin(), range.end(),
+                             [](std::tuple<int&, int&, int&> row) { return std::get<0>(row) % 2 == 1; });
+    CPPUNIT_ASSERT(2 == odd);
+
+    std::vector<std::tuple<int, int, int>> rows(range.begin(), range.end());
+    CPPUNIT_ASSERT(4 == rows.size());
+    CPPUNIT_ASSERT(std::make_tuple(3, 7, 10) == rows[2]);
+
+    std::vector<std::tuple<int, int, int>> copied;
+    std::copy(range.begin(), range.end(), std::back_inserter(copied));
+    CPPUNIT_ASSERT(rows == copied);
+
+    CPPUNIT_ASSERT(4 == std::distance(range.begin(), range.end()));
+    CPPUNIT_ASSERT(std::make_tuple(2, 6, 8) == *std::next(range.begin()));
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestZipRange );
+
+int main()
+{
+    CppUnit::TextUi::TestRunner runner;
+    CppUnit::TestFactoryRegistry &registry = CppUnit::TestFactoryRegistry::getRegistry();
+    runner.addTest(registry.makeTest());
+    bool wasSuccessful = runner.run("", false);
+    return wasSuccessful;
+}
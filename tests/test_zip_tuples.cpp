@@ -2,6 +2,7 @@
 #include <string>
 #include <limits>
 #include <cmath>
+#include <memory>
 #include <cppunit/extensions/TestFactoryRegistry.h>
 #include <cppunit/ui/text/TestRunner.h>
 #include <cppunit/extensions/HelperMacros.h>
@@ -33,6 +34,12 @@ class TestZipTuples : public CppUnit::TestFixture
     CPPUNIT_TEST(testMultipleEmpty);
     CPPUNIT_TEST(testOneEmpty);
     CPPUNIT_TEST(testNoArgs);
+    CPPUNIT_TEST(testMoveOnly);
+    CPPUNIT_TEST(testMixedValueCategories);
+    CPPUNIT_TEST(testRefLvalues);
+    CPPUNIT_TEST(testRefConstLvalues);
+    CPPUNIT_TEST(testRefRvalues);
+    CPPUNIT_TEST(testRefEmpty);
     CPPUNIT_TEST_SUITE_END();
 public:
     void setUp();
@@ -59,6 +66,13 @@ protected:
     void testOneEmpty();
     void testNoArgs();
 
+    void testMoveOnly();
+    void testMixedValueCategories();
+
+    void testRefLvalues();
+    void testRefConstLvalues();
+    void testRefRvalues();
+    void testRefEmpty();
 };
 
 void TestZipTuples::setUp()
@@ -512,6 +526,113 @@ void TestZipTuples::testNoArgs()
     CPPUNIT_ASSERT(std::tuple<>() == result);
 }
 
+void TestZipTuples::testMoveOnly()
+{
+    auto result = tuple_utils::zip(
+        std::make_tuple(std::unique_ptr<int>(new int(1)), std::unique_ptr<int>(new int(2))),
+        std::make_tuple(std::unique_ptr<int>(new int(3)), std::unique_ptr<int>(new int(4)))
+    );
+
+    CPPUNIT_ASSERT(1 == *std::get<0>(std::get<0>(result)));
+    CPPUNIT_ASSERT(3 == *std::get<1>(std::get<0>(result)));
+    CPPUNIT_ASSERT(2 == *std::get<0>(std::get<1>(result)));
+    CPPUNIT_ASSERT(4 == *std::get<1>(std::get<1>(result)));
+}
+
+void TestZipTuples::testMixedValueCategories()
+{
+    auto arg1 = std::make_tuple(std::string("a"), std::string("b"));
+    auto arg2 = std::make_tuple(std::unique_ptr<int>(new int(1)), std::unique_ptr<int>(new int(2)));
+    auto result = tuple_utils::zip(arg1, std::move(arg2));
+
+    CPPUNIT_ASSERT("a" == std::get<0>(std::get<0>(result)));
+    CPPUNIT_ASSERT(2 == *std::get<1>(std::get<1>(result)));
+    CPPUNIT_ASSERT(std::make_tuple(std::string("a"), std::string("b")) == arg1);
+    CPPUNIT_ASSERT(nullptr == std::get<0>(arg2));
+}
+
+void TestZipTuples::testRefLvalues()
+{
+    auto arg1 = std::make_tuple(1, 2.5, 3);
+    auto arg2 = std::make_tuple(std::string("a"), 'b');
+    auto result = tuple_utils::zip_ref(arg1, arg2);
+
+    static_assert(std::is_same<std::tuple_element<
+                                                  0,
+                                                  decltype(result)>::type,
+                                                  std::tuple<int&, std::string&>
+                                              >::value, "Type mismatch");
+    static_assert(std::is_same<std::tuple_element<
+                                                  1,
+                                                  decltype(result)>::type,
+                                                  std::tuple<double&, char&>
+                                              >::value, "Type mismatch");
+
+    CPPUNIT_ASSERT(2 == std::tuple_size<decltype(result)>::value);
+    CPPUNIT_ASSERT(&std::get<0>(arg1) == &std::get<0>(std::get<0>(result)));
+    CPPUNIT_ASSERT(&std::get<1>(arg2) == &std::get<1>(std::get<1>(result)));
+
+    std::get<0>(std::get<0>(result)) = 5;
+    std::get<1>(std::get<0>(result)) += "x";
+    std::get<0>(std::get<1>(result)) = 4.5;
+
+    CPPUNIT_ASSERT(std::make_tuple(5, 4.5, 3) == arg1);
+    CPPUNIT_ASSERT(std::make_tuple(std::string("ax"), 'b') == arg2);
+}
+
+void TestZipTuples::testRefConstLvalues()
+{
+    const auto arg1 = std::make_tuple(1, 2.5);
+    auto arg2 = std::make_tuple(std::string("a"), 'b');
+    auto result = tuple_utils::zip_ref(arg1, arg2);
+
+    static_assert(std::is_same<std::tuple_element<
+                                                  0,
+                                                  decltype(result)>::type,
+                                                  std::tuple<const int&, std::string&>
+                                              >::value, "Type mismatch");
+    static_assert(std::is_same<std::tuple_element<
+                                                  1,
+                                                  decltype(result)>::type,
+                                                  std::tuple<const double&, char&>
+                                              >::value, "Type mismatch");
+
+    CPPUNIT_ASSERT(std::make_tuple(1, std::string("a")) == std::get<0>(result));
+    CPPUNIT_ASSERT(std::make_tuple(2.5, 'b') == std::get<1>(result));
+}
+
+void TestZipTuples::testRefRvalues()
+{
+    auto arg1 = std::make_tuple(std::unique_ptr<int>(new int(1)), std::unique_ptr<int>(new int(2)));
+    auto arg2 = std::make_tuple(std::string("a"), std::string("b"), std::string("c"));
+    auto result = tuple_utils::zip_ref(std::move(arg1), arg2);
+
+    static_assert(std::is_same<std::tuple_element<
+                                                  0,
+                                                  decltype(result)>::type,
+                                                  std::tuple<std::unique_ptr<int>&&, std::string&>
+                                              >::value, "Type mismatch");
+
+    CPPUNIT_ASSERT(2 == std::tuple_size<decltype(result)>::value);
+    //references do not move anything by themselves
+    CPPUNIT_ASSERT(nullptr != std::get<0>(arg1));
+
+    std::unique_ptr<int> moved = std::get<0>(std::move(std::get<1>(result)));
+    CPPUNIT_ASSERT(2 == *moved);
+    CPPUNIT_ASSERT(nullptr == std::get<1>(arg1));
+    CPPUNIT_ASSERT(1 == *std::get<0>(arg1));
+}
+
+void TestZipTuples::testRefEmpty()
+{
+    auto arg1 = std::make_tuple(1, 2);
+    auto arg2 = std::tuple<>();
+    auto result = tuple_utils::zip_ref(arg1, arg2);
+
+    CPPUNIT_ASSERT(0 == std::tuple_size<decltype(result)>::value);
+    CPPUNIT_ASSERT(0 == std::tuple_size<decltype(tuple_utils::zip_ref())>::value);
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION( TestZipTuples );
 
 int main()